@@ -0,0 +1,453 @@
+/*
+	CompactLinkedList.h - LinkedList with minimal per-list overhead
+	For programs keeping thousands of small lists.
+	Has no virtual methods (no vtable pointer), no node cache,
+	size is kept in a configurable unsigned type (uint8_t/uint16_t/...)
+	and empty allocators take no space.
+	It's only root and last pointers plus size, 12 bytes for uint16_t size on 32-bit MCUs.
+
+	Without node cache sequential get(index) is O(index) each time,
+	use iterators to walk the list instead.
+	For compact nodes use StaticLinkedList, it links nodes with 1-2 byte indexes.
+
+	For instructions, go to https://github.com/vortigont/LinkedList
+*/
+
+#pragma once
+
+#include "LinkedList.h"
+#include <stdint.h>
+
+// empty allocator is a base class to take no space in the list object
+template <typename T, typename SizeT = uint16_t, class Alloc = NodeHeapAllocator< ListNode<T> > >
+class CompactLinkedList : private Alloc {
+	static_assert(std::is_unsigned<SizeT>::value, "CompactLinkedList size type must be unsigned");
+
+protected:
+	ListNode<T> *root = nullptr;
+	ListNode<T> *last = nullptr;
+	SizeT _size = 0;
+
+	ListNode<T>* getNode(unsigned index) const;
+
+	/**
+	 * @brief allocate a node and construct T object from args in it
+	 * @return nullptr if allocator has no free nodes or size type is exhausted
+	 */
+	template<class... Args>
+	ListNode<T>* _newNode(ListNode<T>* _next, Args&&... args);
+
+	/**
+	 * @brief destruct node and return it back to allocator
+	 */
+	void _freeNode(ListNode<T>* node);
+
+	/**
+	 * @brief unlink and delete the node next to prev (root if prev is nullptr)
+	 */
+	void _eraseAfter(ListNode<T> *prev);
+
+	/**
+	 * @brief sort nodes with a 'less' predicate
+	 */
+	template<class Less>
+	void _sort(Less &&less);
+
+public:
+	CompactLinkedList(){};
+	CompactLinkedList(unsigned sizeIndex, const T& _t); //initiate list size and default value
+	CompactLinkedList(const CompactLinkedList &rhs) : CompactLinkedList(){ *this = rhs; };	// clone constructor
+	CompactLinkedList(CompactLinkedList &&rhs) : CompactLinkedList(){ *this = std::move(rhs); };	// move constructor
+	~CompactLinkedList(){ clear(); };
+
+	/*
+		Returns current size of the list
+	*/
+	unsigned size() const { return _size; };
+
+	// max number of objects size type could count
+	static constexpr unsigned max_size(){ return sizeof(SizeT) < sizeof(unsigned) ? static_cast<SizeT>(-1) : static_cast<unsigned>(-1); }
+
+	/*
+		Adds a T object in the specified index;
+		Returns false if allocator has no free nodes or list has max_size() objects
+	*/
+	bool add(unsigned index, const T& _t){ return emplace(index, _t); };
+	bool add(unsigned index, T&& _t){ return emplace(index, std::move(_t)); };
+	/*
+		Adds a T object in the end of the list, O(1)
+	*/
+	bool add(const T& _t){ return emplace_back(_t); };
+	bool add(T&& _t){ return emplace_back(std::move(_t)); };
+	/*
+		Adds a T object in the start of the list, O(1)
+	*/
+	bool unshift(const T& _t){ return emplace_front(_t); };
+	bool unshift(T&& _t){ return emplace_front(std::move(_t)); };
+	/*
+		Set the object at index, with T;
+	*/
+	bool set(unsigned index, const T& _t);
+	bool set(unsigned index, T&& _t);
+
+	/**
+	 * @brief construct T object in-place from args at the specified index
+	 */
+	template<class... Args>
+	bool emplace(unsigned index, Args&&... args);
+
+	template<class... Args>
+	bool emplace_back(Args&&... args);
+
+	template<class... Args>
+	bool emplace_front(Args&&... args);
+
+	/*
+		Remove node at index;
+		Returns T object moved out of removed node or T() if index is not reachable
+	*/
+	T remove(unsigned index);
+
+	/*
+		Unlink and delete node at index
+	*/
+	void unlink(unsigned index);
+
+	/*
+		Remove last object, O(n);
+		Returns T object moved out of removed node
+	*/
+	T pop(){ return _size ? remove(_size - 1) : T(); };
+
+	/*
+		Remove first object, O(1);
+		Returns T object moved out of removed node
+	*/
+	T shift(){ return _size ? remove(0) : T(); };
+
+	/*
+		Get the index'th element on the list;
+		Return Element if accessible,
+		else, return T();
+	*/
+	T get(unsigned index) const;
+
+	T front() const { return _size ? root->data : T(); };
+	T back() const { return _size ? last->data : T(); };
+
+	// same as front()
+	T head() const { return front(); }
+
+	// same as back()
+	T tail() const { return back(); }
+
+	bool exist(unsigned index) const { return index < _size; };
+
+	/**
+	 * @brief clear linked list
+	 * NOTE: same as LinkedList::clear() stored pointers are not deleted
+	 */
+	void clear();
+
+	/*
+		Sort the list, given a comparison function
+	*/
+	void sort(int (*cmp)(T &, T &));
+
+	/**
+	 * @brief sort the list with any callable: function, functor or lambda
+	 * stable, see LinkedList::sort(Compare&&)
+	 */
+	template<class Compare = std::less<> >
+	void sort(Compare &&cmp = Compare());
+
+	inline T& operator[](unsigned i) { return getNode(i)->data; }
+	inline const T& operator[](const unsigned i) const { return getNode(i)->data; }
+
+	// deep-copy via assign operator
+	CompactLinkedList & operator =(const CompactLinkedList &rhs);
+
+	/**
+	 * @brief move assignment
+	 * takes over nodes of rhs in O(1) if allocators are always equal,
+	 * otherwise objects are moved one by one, objects left when allocator has no free nodes stay in rhs
+	 */
+	CompactLinkedList & operator =(CompactLinkedList &&rhs);
+
+	/*
+		ConstIterator class
+		provides immutable forward iterator for the list
+	*/
+	struct ConstIterator {
+		using iterator_category = std::forward_iterator_tag;
+		using difference_type   = std::ptrdiff_t;
+		using value_type        = T;
+		using pointer           = const T*;
+		using reference         = const T&;
+
+		ConstIterator(ListNode<T> *ptr = nullptr) : m_ptr(ptr) {}
+
+		reference operator*() const { return m_ptr->data; }
+		pointer operator->() const { return &m_ptr->data; }
+
+		// Prefix increment
+		ConstIterator& operator++() { m_ptr = m_ptr->next; return *this; }
+
+		// Postfix increment
+		ConstIterator operator++(int) { ConstIterator tmp = *this; m_ptr = m_ptr->next; return tmp; }
+
+		bool operator== (const ConstIterator& a) const { return m_ptr == a.m_ptr; };
+		bool operator!= (const ConstIterator& a) const { return m_ptr != a.m_ptr; };
+
+		protected:
+			ListNode<T> *m_ptr;
+	};
+
+	/*
+		Iterator class
+		inherits from ConstIterator, provides mutable forward iterator for the list
+	*/
+	struct Iterator : public ConstIterator {
+		using iterator_category = std::forward_iterator_tag;
+		using difference_type   = std::ptrdiff_t;
+		using value_type        = T;
+		using pointer           = T*;
+		using reference         = T&;
+
+		Iterator(ListNode<T> *ptr = nullptr) : ConstIterator(ptr) {}
+
+		reference operator*() const { return this->m_ptr->data; }
+		pointer operator->() const { return &this->m_ptr->data; }
+
+		Iterator& operator++() { ConstIterator::operator++(); return *this; }
+		Iterator operator++(int) { Iterator tmp = *this; ++(*this); return tmp; }
+	};
+
+	// iterator methods
+	ConstIterator cbegin() const { return ConstIterator(root); }
+	ConstIterator cend() const { return ConstIterator(nullptr); }
+	ConstIterator begin() const { return cbegin(); }
+	ConstIterator end() const { return cend(); }
+	Iterator begin() { return Iterator(root); }
+	Iterator end() { return Iterator(nullptr); }
+};
+
+
+template<typename T, typename SizeT, class Alloc>
+CompactLinkedList<T, SizeT, Alloc>::CompactLinkedList(unsigned sizeIndex, const T& _t){
+	for (unsigned i = 0; i < sizeIndex; i++){
+		add(_t);
+	}
+}
+
+template<typename T, typename SizeT, class Alloc>
+ListNode<T>* CompactLinkedList<T, SizeT, Alloc>::getNode(unsigned index) const {
+	if (index >= _size)
+		return nullptr;
+
+	if (index + 1 == _size)
+		return last;
+
+	ListNode<T> *current = root;
+	while (index--)
+		current = current->next;
+
+	return current;
+}
+
+template<typename T, typename SizeT, class Alloc>
+template<class... Args>
+ListNode<T>* CompactLinkedList<T, SizeT, Alloc>::_newNode(ListNode<T>* _next, Args&&... args){
+	if (_size == max_size())
+		return nullptr;
+
+	ListNode<T> *node = this->allocate();
+	return node ? new (node) ListNode<T>(ListNodeEmplace(), _next, std::forward<Args>(args)...) : nullptr;
+}
+
+template<typename T, typename SizeT, class Alloc>
+void CompactLinkedList<T, SizeT, Alloc>::_freeNode(ListNode<T>* node){
+	node->~ListNode();
+	this->deallocate(node);
+}
+
+template<typename T, typename SizeT, class Alloc>
+template<class... Args>
+bool CompactLinkedList<T, SizeT, Alloc>::emplace(unsigned index, Args&&... args){
+	if (index >= _size)
+		return emplace_back(std::forward<Args>(args)...);
+
+	if (!index)
+		return emplace_front(std::forward<Args>(args)...);
+
+	ListNode<T> *_prev = getNode(index - 1);
+	ListNode<T> *node = _newNode(_prev->next, std::forward<Args>(args)...);
+	if (!node)
+		return false;
+
+	_prev->next = node;
+	++_size;
+	return true;
+}
+
+template<typename T, typename SizeT, class Alloc>
+template<class... Args>
+bool CompactLinkedList<T, SizeT, Alloc>::emplace_back(Args&&... args){
+	ListNode<T> *node = _newNode(nullptr, std::forward<Args>(args)...);
+	if (!node)
+		return false;
+
+	if (root)
+		last->next = node;
+	else
+		root = node;
+
+	last = node;
+	++_size;
+	return true;
+}
+
+template<typename T, typename SizeT, class Alloc>
+template<class... Args>
+bool CompactLinkedList<T, SizeT, Alloc>::emplace_front(Args&&... args){
+	ListNode<T> *node = _newNode(root, std::forward<Args>(args)...);
+	if (!node)
+		return false;
+
+	root = node;
+	if (!last)
+		last = node;
+
+	++_size;
+	return true;
+}
+
+template<typename T, typename SizeT, class Alloc>
+bool CompactLinkedList<T, SizeT, Alloc>::set(unsigned index, const T& _t){
+	if (index >= _size)
+		return false;
+
+	getNode(index)->data = _t;
+	return true;
+}
+
+template<typename T, typename SizeT, class Alloc>
+bool CompactLinkedList<T, SizeT, Alloc>::set(unsigned index, T&& _t){
+	if (index >= _size)
+		return false;
+
+	getNode(index)->data = std::move(_t);
+	return true;
+}
+
+template<typename T, typename SizeT, class Alloc>
+void CompactLinkedList<T, SizeT, Alloc>::_eraseAfter(ListNode<T> *prev){
+	ListNode<T> *node = prev ? prev->next : root;
+
+	if (prev)
+		prev->next = node->next;
+	else
+		root = node->next;
+
+	if (last == node)
+		last = prev;
+
+	_freeNode(node);
+	--_size;
+}
+
+template<typename T, typename SizeT, class Alloc>
+T CompactLinkedList<T, SizeT, Alloc>::remove(unsigned index){
+	if (index >= _size)
+		return T();
+
+	ListNode<T> *_prev = index ? getNode(index - 1) : nullptr;
+	T ret(std::move(_prev ? _prev->next->data : root->data));
+	_eraseAfter(_prev);
+	return ret;
+}
+
+template<typename T, typename SizeT, class Alloc>
+void CompactLinkedList<T, SizeT, Alloc>::unlink(unsigned index){
+	if (index >= _size)
+		return;
+
+	_eraseAfter(index ? getNode(index - 1) : nullptr);
+}
+
+template<typename T, typename SizeT, class Alloc>
+T CompactLinkedList<T, SizeT, Alloc>::get(unsigned index) const {
+	ListNode<T> *node = getNode(index);
+	return node ? node->data : T();
+}
+
+template<typename T, typename SizeT, class Alloc>
+void CompactLinkedList<T, SizeT, Alloc>::clear(){
+	while (root){
+		ListNode<T> *_next = root->next;
+		_freeNode(root);
+		root = _next;
+	}
+
+	last = nullptr;
+	_size = 0;
+}
+
+template<typename T, typename SizeT, class Alloc>
+void CompactLinkedList<T, SizeT, Alloc>::sort(int (*cmp)(T &, T &)){
+	_sort(llist::make_less<T>(cmp));
+}
+
+template<typename T, typename SizeT, class Alloc>
+template<class Compare>
+void CompactLinkedList<T, SizeT, Alloc>::sort(Compare &&cmp){
+	_sort(llist::make_less<T>(cmp));
+}
+
+template<typename T, typename SizeT, class Alloc>
+template<class Less>
+void CompactLinkedList<T, SizeT, Alloc>::_sort(Less &&less){
+	if (_size < 2) return; // trivial case;
+
+	last = llist::sort_chain(root, less);
+}
+
+template<typename T, typename SizeT, class Alloc>
+CompactLinkedList<T, SizeT, Alloc>& CompactLinkedList<T, SizeT, Alloc>::operator =(const CompactLinkedList& rhs){
+	if (this == &rhs)
+		return *this;
+
+	clear();
+	for (const auto& i : rhs)
+		add(i);
+
+	return *this;
+}
+
+template<typename T, typename SizeT, class Alloc>
+CompactLinkedList<T, SizeT, Alloc>& CompactLinkedList<T, SizeT, Alloc>::operator =(CompactLinkedList&& rhs){
+	if (this == &rhs)
+		return *this;
+
+	clear();
+
+	if (!Alloc::is_always_equal){
+		// nodes must stay with rhs's allocator, move objects one by one,
+		// ones which could not be moved for lack of nodes stay in rhs
+		while (rhs._size){
+			if (!emplace_back(std::move(rhs.root->data)))
+				break;
+			rhs.unlink(0);
+		}
+		return *this;
+	}
+
+	root = rhs.root;
+	last = rhs.last;
+	_size = rhs._size;
+
+	rhs.root = rhs.last = nullptr;
+	rhs._size = 0;
+
+	return *this;
+}
@@ -0,0 +1,187 @@
+/*
+	ConcurrentLinkedList.h - Thread-safe wrapper for LinkedList
+	Readers share the lock and run concurrently, writers take exclusive lock.
+
+	LinkedList's get() updates node cache even being const, so concurrent
+	readers would race on it. Here read methods never touch shared cache,
+	instead a caller could keep it's own ReadCursor to get O(1) sequential access.
+
+	For instructions, go to https://github.com/vortigont/LinkedList
+*/
+
+#pragma once
+
+#include "LinkedList.h"
+#include <mutex>
+#include <shared_mutex>
+
+template <typename T, class Alloc = NodeHeapAllocator< ListNode<T> > >
+class ConcurrentLinkedList {
+
+#if __cplusplus >= 201703L
+	using mutex_t = std::shared_mutex;
+#else
+	using mutex_t = std::shared_timed_mutex;
+#endif
+	using list_t = LinkedListCore<T, Alloc>;
+
+protected:
+	list_t _list;
+	mutable mutex_t _mtx;
+	// bumped on every change of the list, makes outdated cursors invalid
+	unsigned long _version = 0;
+
+public:
+	/**
+	 * @brief caller-owned node cache for read access
+	 * each reading thread should keep it's own cursor
+	 */
+	struct ReadCursor {
+		const ListNode<T> *node = nullptr;
+		unsigned index = 0;
+		unsigned long version = 0;
+	};
+
+protected:
+	/**
+	 * @brief find node without touching list's shared cache
+	 * starts from root, last or cursor's node, must be called under a lock
+	 */
+	const ListNode<T>* _peekNode(unsigned index, ReadCursor *cursor) const;
+
+public:
+	ConcurrentLinkedList(){};
+	ConcurrentLinkedList(const ConcurrentLinkedList&) = delete;
+	ConcurrentLinkedList& operator=(const ConcurrentLinkedList&) = delete;
+
+	/*
+		Read methods, take shared lock
+	*/
+	unsigned size() const { std::shared_lock<mutex_t> lock(_mtx); return _list._size; };
+
+	bool exist(unsigned index) const { std::shared_lock<mutex_t> lock(_mtx); return index < _list._size; };
+
+	/*
+		Get the index'th element on the list;
+		Return a copy of Element if accessible,
+		else, return T();
+	*/
+	T get(unsigned index) const;
+
+	/*
+		Get the index'th element on the list using caller's cursor;
+		sequential access with the same cursor is O(1)
+	*/
+	T get(unsigned index, ReadCursor &cursor) const;
+
+	/**
+	 * @brief copy the index'th object to out
+	 * @return false if index is not reachable
+	 */
+	bool try_get(unsigned index, T& out) const;
+
+	T front() const { std::shared_lock<mutex_t> lock(_mtx); return _list.front(); };
+	T back() const { std::shared_lock<mutex_t> lock(_mtx); return _list.back(); };
+
+	/**
+	 * @brief call f(const T&) for each element under shared lock
+	 * f must not call write methods of this list
+	 */
+	template<class F>
+	void for_each(F f) const;
+
+	/*
+		Write methods, take exclusive lock
+	*/
+	bool add(unsigned index, const T& _t){ std::lock_guard<mutex_t> lock(_mtx); ++_version; return _list.add(index, _t); };
+	bool add(unsigned index, T&& _t){ std::lock_guard<mutex_t> lock(_mtx); ++_version; return _list.add(index, std::move(_t)); };
+	bool add(const T& _t){ std::lock_guard<mutex_t> lock(_mtx); ++_version; return _list.add(_t); };
+	bool add(T&& _t){ std::lock_guard<mutex_t> lock(_mtx); ++_version; return _list.add(std::move(_t)); };
+	bool unshift(const T& _t){ std::lock_guard<mutex_t> lock(_mtx); ++_version; return _list.unshift(_t); };
+	bool unshift(T&& _t){ std::lock_guard<mutex_t> lock(_mtx); ++_version; return _list.unshift(std::move(_t)); };
+	bool set(unsigned index, const T& _t){ std::lock_guard<mutex_t> lock(_mtx); return _list.set(index, _t); };
+	bool set(unsigned index, T&& _t){ std::lock_guard<mutex_t> lock(_mtx); return _list.set(index, std::move(_t)); };
+
+	template<class... Args>
+	bool emplace(unsigned index, Args&&... args){ std::lock_guard<mutex_t> lock(_mtx); ++_version; return _list.emplace(index, std::forward<Args>(args)...); };
+	template<class... Args>
+	bool emplace_back(Args&&... args){ std::lock_guard<mutex_t> lock(_mtx); ++_version; return _list.emplace_back(std::forward<Args>(args)...); };
+	template<class... Args>
+	bool emplace_front(Args&&... args){ std::lock_guard<mutex_t> lock(_mtx); ++_version; return _list.emplace_front(std::forward<Args>(args)...); };
+
+	T remove(unsigned index){ std::lock_guard<mutex_t> lock(_mtx); ++_version; return _list.remove(index); };
+	void unlink(unsigned index){ std::lock_guard<mutex_t> lock(_mtx); ++_version; _list.unlink(index); };
+	T pop(){ std::lock_guard<mutex_t> lock(_mtx); ++_version; return _list.pop(); };
+	T shift(){ std::lock_guard<mutex_t> lock(_mtx); ++_version; return _list.shift(); };
+	// check for emptiness and removal are done under one lock, safe for concurrent consumers
+	bool try_pop(T& out){ std::lock_guard<mutex_t> lock(_mtx); ++_version; return _list.try_pop(out); };
+	bool try_shift(T& out){ std::lock_guard<mutex_t> lock(_mtx); ++_version; return _list.try_shift(out); };
+	void clear(){ std::lock_guard<mutex_t> lock(_mtx); ++_version; _list.clear(); };
+	void sort(int (*cmp)(T &, T &)){ std::lock_guard<mutex_t> lock(_mtx); ++_version; _list.sort(cmp); };
+	template<class Compare = std::less<> >
+	void sort(Compare &&cmp = Compare()){ std::lock_guard<mutex_t> lock(_mtx); ++_version; _list.sort(std::forward<Compare>(cmp)); };
+};
+
+
+template<typename T, class Alloc>
+const ListNode<T>* ConcurrentLinkedList<T, Alloc>::_peekNode(unsigned index, ReadCursor *cursor) const {
+	if (index >= _list._size)
+		return nullptr;
+
+	if (index == _list._size - 1)
+		return _list.last;
+
+	const ListNode<T> *current = _list.root;
+	unsigned _pos = 0;
+
+	if (cursor && cursor->node && cursor->version == _version && cursor->index <= index){
+		current = cursor->node;
+		_pos = cursor->index;
+	}
+
+	while (_pos < index){
+		current = current->next;
+		++_pos;
+	}
+
+	if (cursor){
+		cursor->node = current;
+		cursor->index = index;
+		cursor->version = _version;
+	}
+
+	return current;
+}
+
+template<typename T, class Alloc>
+T ConcurrentLinkedList<T, Alloc>::get(unsigned index) const {
+	std::shared_lock<mutex_t> lock(_mtx);
+	const ListNode<T> *node = _peekNode(index, nullptr);
+	return node ? node->data : T();
+}
+
+template<typename T, class Alloc>
+T ConcurrentLinkedList<T, Alloc>::get(unsigned index, ReadCursor &cursor) const {
+	std::shared_lock<mutex_t> lock(_mtx);
+	const ListNode<T> *node = _peekNode(index, &cursor);
+	return node ? node->data : T();
+}
+
+template<typename T, class Alloc>
+bool ConcurrentLinkedList<T, Alloc>::try_get(unsigned index, T& out) const {
+	std::shared_lock<mutex_t> lock(_mtx);
+	const ListNode<T> *node = _peekNode(index, nullptr);
+	if (!node)
+		return false;
+
+	out = node->data;
+	return true;
+}
+
+template<typename T, class Alloc>
+template<class F>
+void ConcurrentLinkedList<T, Alloc>::for_each(F f) const {
+	std::shared_lock<mutex_t> lock(_mtx);
+	for (const ListNode<T> *node = _list.root; node; node = node->next)
+		f(node->data);
+}
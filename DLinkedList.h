@@ -0,0 +1,568 @@
+/*
+	DLinkedList.h - Generic doubly linked list implementation
+	Shares LinkedList API, but each node keeps a pointer to the previous one,
+	so pop() is O(1), nodes are reached from the closest end of the list
+	and iterators could go backwards
+
+	For instructions, go to https://github.com/vortigont/LinkedList
+*/
+
+#pragma once
+
+#include "LinkedList.h"
+
+template<class T>
+struct DListNode
+{
+	T data;
+	DListNode<T> *next;
+	DListNode<T> *prev;
+
+	// construct data object in-place from arbitrary args
+	template<class... Args>
+	DListNode(ListNodeEmplace, DListNode<T>* _prev, DListNode<T>* _next, Args&&... args) : data(std::forward<Args>(args)...), next(_next), prev(_prev) {}
+};
+
+template <typename T, class Alloc = NodeHeapAllocator< DListNode<T> > >
+class DLinkedList{
+
+protected:
+	Alloc _alloc;
+	unsigned _size = 0;
+	DListNode<T> *root = nullptr;
+	DListNode<T> *last = nullptr;
+
+	// Helps "get" method, by saving last position
+	mutable DListNode<T> *lastNodeGot = nullptr;
+	mutable unsigned lastIndexGot=0;		// cached node index
+
+	/**
+	 * @brief find node at index
+	 * walks from root, last or cached node, whichever is closer to index
+	 */
+	DListNode<T>* getNode(unsigned index) const;
+
+	/**
+	 * @brief take new node from allocator and construct it's data in-place from args
+	 * @return pointer to the new node or nullptr if allocator is out of memory
+	 */
+	template<class... Args>
+	DListNode<T>* _newNode(DListNode<T>* _prev, DListNode<T>* _next, Args&&... args);
+
+	/**
+	 * @brief destruct node and return it back to allocator
+	 */
+	void _freeNode(DListNode<T>* node);
+
+	/**
+	 * @brief unlink and delete node with specified index
+	 */
+	void _erase(DListNode<T>* node, unsigned index);
+
+	/**
+	 * @brief sort nodes with a 'less' predicate
+	 */
+	template<class Less>
+	void _sort(Less &&less);
+
+public:
+	DLinkedList(){};
+	DLinkedList(unsigned sizeIndex, const T& _t); //initiate list size and default value
+	DLinkedList(const DLinkedList &rhs) : DLinkedList(){ *this = rhs; };	// clone constructor
+	DLinkedList(DLinkedList &&rhs) : DLinkedList(){ *this = std::move(rhs); };	// move constructor
+	~DLinkedList(){ clear(); };
+
+	/*
+		Returns current size of DLinkedList
+	*/
+	unsigned size() const { return _size; };
+
+	/*
+		Adds a T object in the specified index;
+		Returns false if allocator has no free nodes
+	*/
+	bool add(unsigned index, const T& _t){ return emplace(index, _t); };
+	bool add(unsigned index, T&& _t){ return emplace(index, std::move(_t)); };
+
+	/*
+		Adds a T object in the end of the DLinkedList;
+	*/
+	bool add(const T& _t){ return emplace_back(_t); };
+	bool add(T&& _t){ return emplace_back(std::move(_t)); };
+
+	/*
+		Adds a T object in the start of the DLinkedList;
+	*/
+	bool unshift(const T& _t){ return emplace_front(_t); };
+	bool unshift(T&& _t){ return emplace_front(std::move(_t)); };
+
+	/*
+		Set the object at index, with T;
+	*/
+	bool set(unsigned index, const T& _t);
+	bool set(unsigned index, T&& _t);
+
+	/**
+	 * @brief construct T object in-place from args at the specified index
+	 */
+	template<class... Args>
+	bool emplace(unsigned index, Args&&... args);
+
+	/**
+	 * @brief construct T object in-place from args in the end of the list
+	 */
+	template<class... Args>
+	bool emplace_back(Args&&... args);
+
+	/**
+	 * @brief construct T object in-place from args in the start of the list
+	 */
+	template<class... Args>
+	bool emplace_front(Args&&... args);
+
+	/*
+		Remove node at index;
+		Returns T object moved out of removed node or T() if index is not reachable
+	*/
+	T remove(unsigned index);
+
+	/*
+		Unlink and delete node at index;
+	*/
+	void unlink(unsigned index);
+
+	/*
+		Remove last object, O(1);
+		Returns T object moved out of removed node
+	*/
+	T pop();
+
+	/**
+	 * @brief 		Remove first object
+	 *	Returns T object moved out of removed node
+	 */
+	T shift();
+
+	/*
+		Get the index'th element on the list;
+		Return Element if accessible,
+		else, return T();
+	*/
+	T get(unsigned index) const;
+
+	// Get first element of the list or T() if list is empty
+	T front() const { return _size ? root->data : T(); };
+
+	// Get last element of the list or T() if list is empty
+	T back() const { return _size ? last->data : T(); };
+
+	// same as front()
+	T head() const { return front(); }
+
+	// same as back()
+	T tail() const { return back(); }
+
+	/*
+		Return true if element with specified index exist
+	*/
+	bool exist(unsigned index) const { return index < _size; };
+
+	/**
+	 * @brief clear linked list
+	 * NOTE: same as LinkedList::clear() stored pointers are not deleted
+	 */
+	void clear();
+
+	/*
+		Sort the list, given a comparison function
+	*/
+	void sort(int (*cmp)(T &, T &));
+
+	/**
+	 * @brief sort the list with any callable: function, functor or lambda
+	 * stable, see LinkedList::sort(Compare&&)
+	 */
+	template<class Compare = std::less<> >
+	void sort(Compare &&cmp = Compare());
+
+	inline T& operator[](unsigned i) { return getNode(i)->data; }
+	inline const T& operator[](const unsigned i) const { return getNode(i)->data; }
+
+	// deep-copy via assign operator
+	DLinkedList & operator =(const DLinkedList &rhs);
+
+	// move assignment, takes over nodes chain of rhs if allocator allows it,
+	// otherwise moves objects one by one, objects left when allocator has no free nodes stay in rhs
+	DLinkedList & operator =(DLinkedList &&rhs);
+
+	/*
+		ConstIterator class
+		provides immutable bidirectional iterator for the list
+		end() iterator could be decremented to get the last element
+	*/
+	struct ConstIterator {
+		using iterator_category = std::bidirectional_iterator_tag;
+		using difference_type   = std::ptrdiff_t;
+		using value_type        = T;
+		using pointer           = const T*;
+		using reference         = const T&;
+
+		ConstIterator(DListNode<T> *ptr = nullptr, const DLinkedList *list = nullptr) : m_ptr(ptr), m_list(list) {}
+
+		reference operator*() const { return m_ptr->data; }
+		pointer operator->() const { return &m_ptr->data; }
+
+		// Prefix increment/decrement
+		ConstIterator& operator++() { m_ptr = m_ptr->next; return *this; }
+		ConstIterator& operator--() { m_ptr = m_ptr ? m_ptr->prev : m_list->last; return *this; }
+
+		// Postfix increment/decrement
+		ConstIterator operator++(int) { ConstIterator tmp = *this; ++(*this); return tmp; }
+		ConstIterator operator--(int) { ConstIterator tmp = *this; --(*this); return tmp; }
+
+		bool operator== (const ConstIterator& a) const { return m_ptr == a.m_ptr; };
+		bool operator!= (const ConstIterator& a) const { return m_ptr != a.m_ptr; };
+
+		friend DLinkedList;
+
+		protected:
+			DListNode<T> *m_ptr;
+			const DLinkedList *m_list;
+	};
+
+	/*
+		Iterator class
+		inherits from ConstIterator, provides mutable bidirectional iterator for the list
+	*/
+	struct Iterator : public ConstIterator {
+		using iterator_category = std::bidirectional_iterator_tag;
+		using difference_type   = std::ptrdiff_t;
+		using value_type        = T;
+		using pointer           = T*;
+		using reference         = T&;
+
+		Iterator(DListNode<T> *ptr = nullptr, const DLinkedList *list = nullptr) : ConstIterator(ptr, list) {}
+
+		reference operator*() const { return this->m_ptr->data; }
+		pointer operator->() const { return &this->m_ptr->data; }
+
+		Iterator& operator++() { ConstIterator::operator++(); return *this; }
+		Iterator& operator--() { ConstIterator::operator--(); return *this; }
+		Iterator operator++(int) { Iterator tmp = *this; ++(*this); return tmp; }
+		Iterator operator--(int) { Iterator tmp = *this; --(*this); return tmp; }
+	};
+
+	using ConstReverseIterator = std::reverse_iterator<ConstIterator>;
+	using ReverseIterator = std::reverse_iterator<Iterator>;
+
+	// iterator methods
+	ConstIterator cbegin() const { return ConstIterator(root, this); }
+	ConstIterator cend() const { return ConstIterator(nullptr, this); }
+	ConstIterator begin() const { return cbegin(); }
+	ConstIterator end() const { return cend(); }
+	Iterator begin() { return Iterator(root, this); }
+	Iterator end() { return Iterator(nullptr, this); }
+
+	// reverse iterator methods
+	ConstReverseIterator crbegin() const { return ConstReverseIterator(cend()); }
+	ConstReverseIterator crend() const { return ConstReverseIterator(cbegin()); }
+	ConstReverseIterator rbegin() const { return crbegin(); }
+	ConstReverseIterator rend() const { return crend(); }
+	ReverseIterator rbegin() { return ReverseIterator(end()); }
+	ReverseIterator rend() { return ReverseIterator(begin()); }
+};
+
+
+template<typename T, class Alloc>
+DLinkedList<T, Alloc>::DLinkedList(unsigned sizeIndex, const T& _t){
+	for (unsigned i = 0; i < sizeIndex; i++){
+		add(_t);
+	}
+}
+
+template<typename T, class Alloc>
+DListNode<T>* DLinkedList<T, Alloc>::getNode(unsigned index) const {
+	if (index >= _size)
+		return nullptr;
+
+	// start from the closest end
+	DListNode<T> *current = root;
+	unsigned _pos = 0;
+	if (_size - 1 - index < index){
+		current = last;
+		_pos = _size - 1;
+	}
+
+	// check if cached node is even closer
+	if (lastNodeGot){
+		unsigned cache_dist = lastIndexGot > index ? lastIndexGot - index : index - lastIndexGot;
+		unsigned dist = _pos > index ? _pos - index : index - _pos;
+		if (cache_dist < dist){
+			current = lastNodeGot;
+			_pos = lastIndexGot;
+		}
+	}
+
+	while (_pos < index){
+		current = current->next;
+		++_pos;
+	}
+
+	while (_pos > index){
+		current = current->prev;
+		--_pos;
+	}
+
+	lastIndexGot = index;
+	lastNodeGot = current;
+	return current;
+}
+
+template<typename T, class Alloc>
+template<class... Args>
+DListNode<T>* DLinkedList<T, Alloc>::_newNode(DListNode<T>* _prev, DListNode<T>* _next, Args&&... args){
+	DListNode<T> *node = _alloc.allocate();
+	return node ? new (node) DListNode<T>(ListNodeEmplace(), _prev, _next, std::forward<Args>(args)...) : nullptr;
+}
+
+template<typename T, class Alloc>
+void DLinkedList<T, Alloc>::_freeNode(DListNode<T>* node){
+	node->~DListNode();
+	_alloc.deallocate(node);
+}
+
+template<typename T, class Alloc>
+template<class... Args>
+bool DLinkedList<T, Alloc>::emplace(unsigned index, Args&&... args){
+	if(index >= _size)
+		return emplace_back(std::forward<Args>(args)...);
+
+	if(!index)
+		return emplace_front(std::forward<Args>(args)...);
+
+	DListNode<T> *_next = getNode(index);
+	DListNode<T> *node = _newNode(_next->prev, _next, std::forward<Args>(args)...);
+	if (!node)
+		return false;
+
+	_next->prev->next = node;
+	_next->prev = node;
+	lastNodeGot = node;
+	++_size;
+
+	return true;
+}
+
+template<typename T, class Alloc>
+template<class... Args>
+bool DLinkedList<T, Alloc>::emplace_back(Args&&... args){
+	DListNode<T> *node = _newNode(last, nullptr, std::forward<Args>(args)...);
+	if (!node)
+		return false;
+
+	if (last)
+		last->next = node;
+	else
+		root = node;
+
+	last = node;
+	lastIndexGot = _size;
+	lastNodeGot = node;
+	++_size;
+
+	return true;
+}
+
+template<typename T, class Alloc>
+template<class... Args>
+bool DLinkedList<T, Alloc>::emplace_front(Args&&... args){
+	DListNode<T> *node = _newNode(nullptr, root, std::forward<Args>(args)...);
+	if (!node)
+		return false;
+
+	if (root)
+		root->prev = node;
+	else
+		last = node;
+
+	root = node;
+	lastIndexGot = 0;
+	lastNodeGot = node;
+	++_size;
+
+	return true;
+}
+
+template<typename T, class Alloc>
+bool DLinkedList<T, Alloc>::set(unsigned index, const T& _t){
+	if(index >= _size)
+		return false;
+
+	getNode(index)->data = _t;
+	return true;
+}
+
+template<typename T, class Alloc>
+bool DLinkedList<T, Alloc>::set(unsigned index, T&& _t){
+	if(index >= _size)
+		return false;
+
+	getNode(index)->data = std::move(_t);
+	return true;
+}
+
+template<typename T, class Alloc>
+void DLinkedList<T, Alloc>::_erase(DListNode<T>* node, unsigned index){
+	DListNode<T> *_prev = node->prev;
+	DListNode<T> *_next = node->next;
+
+	if (_prev)
+		_prev->next = _next;
+	else
+		root = _next;
+
+	if (_next)
+		_next->prev = _prev;
+	else
+		last = _prev;
+
+	_freeNode(node);
+	--_size;
+
+	// cache neighbour node, next node takes index of the removed one
+	if (_next){
+		lastNodeGot = _next;
+		lastIndexGot = index;
+	} else {
+		lastNodeGot = _prev;
+		lastIndexGot = index ? index - 1 : 0;
+	}
+}
+
+template<typename T, class Alloc>
+T DLinkedList<T, Alloc>::pop(){
+	if(!_size)
+		return T();
+
+	T ret(std::move(last->data));
+	_erase(last, _size - 1);
+	return ret;
+}
+
+template<typename T, class Alloc>
+T DLinkedList<T, Alloc>::shift(){
+	if(!_size)
+		return T();
+
+	T ret(std::move(root->data));
+	_erase(root, 0);
+	return ret;
+}
+
+template<typename T, class Alloc>
+T DLinkedList<T, Alloc>::remove(unsigned index){
+	DListNode<T> *node = getNode(index);
+	if (!node)
+		return T();
+
+	T ret(std::move(node->data));
+	_erase(node, index);
+	return ret;
+}
+
+template<typename T, class Alloc>
+void DLinkedList<T, Alloc>::unlink(unsigned index){
+	DListNode<T> *node = getNode(index);
+	if (node)
+		_erase(node, index);
+}
+
+template<typename T, class Alloc>
+T DLinkedList<T, Alloc>::get(unsigned index) const {
+	DListNode<T> *tmp = getNode(index);
+
+	return (tmp ? tmp->data : T());
+}
+
+template<typename T, class Alloc>
+void DLinkedList<T, Alloc>::clear(){
+	while (root){
+		DListNode<T> *_next = root->next;
+		_freeNode(root);
+		root = _next;
+	}
+
+	last = lastNodeGot = nullptr;
+	_size = lastIndexGot = 0;
+}
+
+template<typename T, class Alloc>
+void DLinkedList<T, Alloc>::sort(int (*cmp)(T &, T &)){
+	_sort(llist::make_less<T>(cmp));
+}
+
+template<typename T, class Alloc>
+template<class Compare>
+void DLinkedList<T, Alloc>::sort(Compare &&cmp){
+	_sort(llist::make_less<T>(cmp));
+}
+
+template<typename T, class Alloc>
+template<class Less>
+void DLinkedList<T, Alloc>::_sort(Less &&less){
+	if(_size < 2) return; // trivial case;
+
+	// sort forward links, then restore backward links in one pass
+	last = llist::sort_chain(root, less);
+
+	DListNode<T> *_prev = nullptr;
+	for (DListNode<T> *node = root; node; node = node->next){
+		node->prev = _prev;
+		_prev = node;
+	}
+
+	lastNodeGot = root;
+	lastIndexGot = 0;
+}
+
+template<typename T, class Alloc>
+DLinkedList<T, Alloc>& DLinkedList<T, Alloc>::operator =(const DLinkedList& rhs) {
+	if (this == &rhs)
+		return *this;
+
+	clear();
+	for (const auto& i : rhs)
+		add(i);
+
+	return *this;
+}
+
+template<typename T, class Alloc>
+DLinkedList<T, Alloc>& DLinkedList<T, Alloc>::operator =(DLinkedList&& rhs) {
+	if (this == &rhs)
+		return *this;
+
+	clear();
+
+	if (!Alloc::is_always_equal){
+		// nodes must stay with rhs's allocator, move objects one by one,
+		// ones which could not be moved for lack of nodes stay in rhs
+		while (rhs._size){
+			if (!emplace_back(std::move(rhs.root->data)))
+				break;
+			rhs.unlink(0);
+		}
+		return *this;
+	}
+
+	root = rhs.root;
+	last = rhs.last;
+	_size = rhs._size;
+	lastNodeGot = rhs.lastNodeGot;
+	lastIndexGot = rhs.lastIndexGot;
+
+	rhs.root = rhs.last = rhs.lastNodeGot = nullptr;
+	rhs._size = rhs.lastIndexGot = 0;
+
+	return *this;
+}
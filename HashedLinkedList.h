@@ -0,0 +1,418 @@
+/*
+	HashedLinkedList.h - LinkedList with a hash index by key
+	Keeps insertion order like LinkedList, and also a hash table
+	of node pointers keyed by KeyOf(object), so lookups by key are O(1) on average.
+	The index is updated by every method changing the list,
+	sort() only relinks nodes, so the index stays valid for free.
+
+	Objects are accessible read-only via iterators and references,
+	use set() to change an object, it's key might change.
+
+	For instructions, go to https://github.com/vortigont/LinkedList
+*/
+
+#pragma once
+
+#include "LinkedList.h"
+#include <stdint.h>
+
+/**
+ * @brief LinkedList with hash index
+ * @tparam KeyOf - functor returning object's key, i.e. [](const T& v){ return v.id; }
+ * @tparam Hash - hash functor for the key type
+ */
+template <typename T, class KeyOf,
+	class Hash = std::hash< typename std::decay<decltype(std::declval<KeyOf&>()(std::declval<const T&>()))>::type >,
+	class Alloc = NodeHeapAllocator< ListNode<T> > >
+class HashedLinkedList {
+	using list_t = LinkedListCore<T, Alloc>;
+
+public:
+	using key_type = typename std::decay<decltype(std::declval<KeyOf&>()(std::declval<const T&>()))>::type;
+
+protected:
+	list_t _list;
+	KeyOf _key;
+	Hash _hash;
+	// open addressing table with linear probing, nullptr is an empty slot
+	ListNode<T> **_table = nullptr;
+	// table capacity - 1, capacity is a power of 2
+	unsigned _mask = 0;
+	// log2 of table capacity
+	unsigned char _bits = 0;
+
+	/*
+		home slot of the key, hash bits are mixed by Fibonacci hashing and the high ones are taken.
+		std::hash of integers is identity, with it's low bits taken as is
+		keys differing only in high bits would end up in one long probe run
+	*/
+	unsigned _home(const key_type &key) const {
+		uint64_t h = static_cast<uint64_t>(_hash(key));
+		return static_cast<uint32_t>(static_cast<uint32_t>(h ^ (h >> 32)) * UINT32_C(0x9E3779B9)) >> (32 - _bits);
+	}
+
+	/**
+	 * @brief make room for one more node in the table
+	 * table grows twice when it's half full
+	 * @return false if table is too full and there is no memory to grow it
+	 */
+	bool _reserve();
+
+	// (re)allocate table for cap slots and index all nodes
+	bool _rehash(unsigned cap);
+
+	void _insertIndex(ListNode<T> *node);
+	void _eraseIndex(ListNode<T> *node);
+
+	// find node by key
+	ListNode<T>* _findNode(const key_type &key) const;
+
+public:
+	HashedLinkedList(){};
+	HashedLinkedList(const HashedLinkedList &rhs) : HashedLinkedList(){ *this = rhs; };	// clone constructor
+	HashedLinkedList(HashedLinkedList &&rhs) : HashedLinkedList(){ *this = std::move(rhs); };	// move constructor
+	~HashedLinkedList(){ _list.clear(); delete[] _table; };
+
+	HashedLinkedList & operator =(const HashedLinkedList &rhs);
+	HashedLinkedList & operator =(HashedLinkedList &&rhs);
+
+	/*
+		Read methods, same as LinkedList ones
+	*/
+	unsigned size() const { return _list.size(); };
+	T get(unsigned index) const { return _list.get(index); };
+	T front() const { return _list.front(); };
+	T back() const { return _list.back(); };
+	bool exist(unsigned index) const { return _list.exist(index); };
+	bool contains(const T& value) const { return _list.contains(value); };
+	int index_of(const T& value) const { return _list.index_of(value); };
+	bool try_get(unsigned index, T& out) const { return _list.try_get(index, out); };
+
+	const T& operator[](unsigned i) const { return _list[i]; }
+
+	// objects found are read-only, their key must not change behind the index
+	const T* find(const T& value) const { return _list.find(value); }
+	template<class Pred>
+	const T* find_if(Pred pred) const { return _list.find_if(pred); }
+
+	/*
+		Adds a T object in the specified index / end / start of the list;
+		Returns false if allocator has no free nodes or there is no memory for the index
+	*/
+	bool add(unsigned index, const T& _t){ return emplace(index, _t); };
+	bool add(unsigned index, T&& _t){ return emplace(index, std::move(_t)); };
+	bool add(const T& _t){ return emplace_back(_t); };
+	bool add(T&& _t){ return emplace_back(std::move(_t)); };
+	bool unshift(const T& _t){ return emplace_front(_t); };
+	bool unshift(T&& _t){ return emplace_front(std::move(_t)); };
+
+	template<class... Args>
+	bool emplace(unsigned index, Args&&... args);
+	template<class... Args>
+	bool emplace_back(Args&&... args){ return emplace(_list._size, std::forward<Args>(args)...); };
+	template<class... Args>
+	bool emplace_front(Args&&... args){ return emplace(0, std::forward<Args>(args)...); };
+
+	/*
+		Set the object at index, object is reindexed by it's new key
+	*/
+	bool set(unsigned index, const T& _t);
+	bool set(unsigned index, T&& _t);
+
+	T remove(unsigned index);
+	void unlink(unsigned index);
+	T pop();
+	T shift();
+	bool try_pop(T& out);
+	bool try_shift(T& out);
+
+	void clear();
+
+	/*
+		Sort the list, index is not changed
+	*/
+	void sort(int (*cmp)(T &, T &)){ _list.sort(cmp); };
+	template<class Compare = std::less<> >
+	void sort(Compare &&cmp = Compare()){ _list.sort(std::forward<Compare>(cmp)); };
+
+	/**
+	 * @brief find object by key, O(1) on average
+	 * if there are several objects with the same key any of them could be returned
+	 * @return pointer to the object or nullptr if not found
+	 */
+	const T* find_key(const key_type &key) const { ListNode<T> *node = _findNode(key); return node ? &node->data : nullptr; };
+
+	bool contains_key(const key_type &key) const { return _findNode(key) != nullptr; };
+
+	/**
+	 * @brief remove object by key
+	 * lookup is O(1), but unlinking the node needs it's predecessor, so it's O(n)
+	 * @return false if not found
+	 */
+	bool remove_key(const key_type &key);
+
+	// objects are immutable via iterators, key must not change behind the index
+	using ConstIterator = typename list_t::ConstIterator;
+	ConstIterator cbegin() const { return _list.cbegin(); }
+	ConstIterator cend() const { return _list.cend(); }
+	ConstIterator begin() const { return _list.cbegin(); }
+	ConstIterator end() const { return _list.cend(); }
+};
+
+
+template<typename T, class KeyOf, class Hash, class Alloc>
+bool HashedLinkedList<T, KeyOf, Hash, Alloc>::_rehash(unsigned cap){
+	ListNode<T> **table = new (std::nothrow) ListNode<T>*[cap]();
+	if (!table)
+		return false;
+
+	delete[] _table;
+	_table = table;
+	_mask = cap - 1;
+	for (_bits = 0; (1u << _bits) < cap; ++_bits);
+
+	for (ListNode<T> *node = _list.root; node; node = node->next)
+		_insertIndex(node);
+
+	return true;
+}
+
+template<typename T, class KeyOf, class Hash, class Alloc>
+bool HashedLinkedList<T, KeyOf, Hash, Alloc>::_reserve(){
+	unsigned cap = _table ? _mask + 1 : 0;
+	unsigned need = _list._size + 1;
+
+	if (need * 2 <= cap)
+		return true;
+
+	if (_rehash(cap ? cap * 2 : 8))
+		return true;
+
+	// no memory to grow, keep going until table is 3/4 full
+	return need * 4 <= cap * 3;
+}
+
+template<typename T, class KeyOf, class Hash, class Alloc>
+void HashedLinkedList<T, KeyOf, Hash, Alloc>::_insertIndex(ListNode<T> *node){
+	unsigned i = _home(_key(static_cast<const T&>(node->data)));
+	while (_table[i])
+		i = (i + 1) & _mask;
+
+	_table[i] = node;
+}
+
+template<typename T, class KeyOf, class Hash, class Alloc>
+void HashedLinkedList<T, KeyOf, Hash, Alloc>::_eraseIndex(ListNode<T> *node){
+	unsigned i = _home(_key(static_cast<const T&>(node->data)));
+	while (_table[i] != node)
+		i = (i + 1) & _mask;
+
+	// shift following entries of the probe sequence back, so there are no holes in it
+	unsigned j = i;
+	for (;;){
+		j = (j + 1) & _mask;
+		if (!_table[j])
+			break;
+
+		unsigned home = _home(_key(static_cast<const T&>(_table[j]->data)));
+		// entry at j could be moved to i if it's home slot is not within (i, j] cyclically
+		if ((i < j) ? (home <= i || home > j) : (home <= i && home > j)){
+			_table[i] = _table[j];
+			i = j;
+		}
+	}
+
+	_table[i] = nullptr;
+}
+
+template<typename T, class KeyOf, class Hash, class Alloc>
+ListNode<T>* HashedLinkedList<T, KeyOf, Hash, Alloc>::_findNode(const key_type &key) const {
+	if (!_table)
+		return nullptr;
+
+	for (unsigned i = _home(key); _table[i]; i = (i + 1) & _mask){
+		if (_key(static_cast<const T&>(_table[i]->data)) == key)
+			return _table[i];
+	}
+
+	return nullptr;
+}
+
+template<typename T, class KeyOf, class Hash, class Alloc>
+template<class... Args>
+bool HashedLinkedList<T, KeyOf, Hash, Alloc>::emplace(unsigned index, Args&&... args){
+	if (!_reserve())
+		return false;
+
+	if (index > _list._size)
+		index = _list._size;
+
+	if (!_list.emplace(index, std::forward<Args>(args)...))
+		return false;
+
+	// new node is cached by the list, so it's found without walking
+	_insertIndex(_list.getNode(index));
+	return true;
+}
+
+template<typename T, class KeyOf, class Hash, class Alloc>
+bool HashedLinkedList<T, KeyOf, Hash, Alloc>::set(unsigned index, const T& _t){
+	ListNode<T> *node = _list.getNode(index);
+	if (!node)
+		return false;
+
+	_eraseIndex(node);
+	node->data = _t;
+	_insertIndex(node);
+	return true;
+}
+
+template<typename T, class KeyOf, class Hash, class Alloc>
+bool HashedLinkedList<T, KeyOf, Hash, Alloc>::set(unsigned index, T&& _t){
+	ListNode<T> *node = _list.getNode(index);
+	if (!node)
+		return false;
+
+	_eraseIndex(node);
+	node->data = std::move(_t);
+	_insertIndex(node);
+	return true;
+}
+
+template<typename T, class KeyOf, class Hash, class Alloc>
+T HashedLinkedList<T, KeyOf, Hash, Alloc>::remove(unsigned index){
+	ListNode<T> *node = _list.getNode(index);
+	if (!node)
+		return T();
+
+	_eraseIndex(node);
+	return _list.remove(index);
+}
+
+template<typename T, class KeyOf, class Hash, class Alloc>
+void HashedLinkedList<T, KeyOf, Hash, Alloc>::unlink(unsigned index){
+	ListNode<T> *node = _list.getNode(index);
+	if (!node)
+		return;
+
+	_eraseIndex(node);
+	_list.unlink(index);
+}
+
+template<typename T, class KeyOf, class Hash, class Alloc>
+T HashedLinkedList<T, KeyOf, Hash, Alloc>::pop(){
+	if (!_list._size)
+		return T();
+
+	_eraseIndex(_list.last);
+	return _list.pop();
+}
+
+template<typename T, class KeyOf, class Hash, class Alloc>
+T HashedLinkedList<T, KeyOf, Hash, Alloc>::shift(){
+	if (!_list._size)
+		return T();
+
+	_eraseIndex(_list.root);
+	return _list.shift();
+}
+
+template<typename T, class KeyOf, class Hash, class Alloc>
+bool HashedLinkedList<T, KeyOf, Hash, Alloc>::try_pop(T& out){
+	if (!_list._size)
+		return false;
+
+	_eraseIndex(_list.last);
+	return _list.try_pop(out);
+}
+
+template<typename T, class KeyOf, class Hash, class Alloc>
+bool HashedLinkedList<T, KeyOf, Hash, Alloc>::try_shift(T& out){
+	if (!_list._size)
+		return false;
+
+	_eraseIndex(_list.root);
+	return _list.try_shift(out);
+}
+
+template<typename T, class KeyOf, class Hash, class Alloc>
+void HashedLinkedList<T, KeyOf, Hash, Alloc>::clear(){
+	_list.clear();
+	if (_table){
+		for (unsigned i = 0; i <= _mask; ++i)
+			_table[i] = nullptr;
+	}
+}
+
+template<typename T, class KeyOf, class Hash, class Alloc>
+bool HashedLinkedList<T, KeyOf, Hash, Alloc>::remove_key(const key_type &key){
+	ListNode<T> *node = _findNode(key);
+	if (!node)
+		return false;
+
+	_eraseIndex(node);
+
+	ListNode<T> *prev = nullptr;
+	unsigned index = 0;
+	for (ListNode<T> *p = _list.root; p != node; prev = p, p = p->next)
+		++index;
+
+	if (prev)
+		_list._eraseAfter(prev, index - 1);
+	else
+		_list._shift();
+
+	return true;
+}
+
+template<typename T, class KeyOf, class Hash, class Alloc>
+HashedLinkedList<T, KeyOf, Hash, Alloc>& HashedLinkedList<T, KeyOf, Hash, Alloc>::operator =(const HashedLinkedList& rhs){
+	if (this == &rhs)
+		return *this;
+
+	clear();
+	for (const auto& i : rhs)
+		add(i);
+
+	return *this;
+}
+
+template<typename T, class KeyOf, class Hash, class Alloc>
+HashedLinkedList<T, KeyOf, Hash, Alloc>& HashedLinkedList<T, KeyOf, Hash, Alloc>::operator =(HashedLinkedList&& rhs){
+	if (this == &rhs)
+		return *this;
+
+	clear();
+
+	if (Alloc::is_always_equal){
+		// nodes are taken over in O(1), so is their index, rhs gets the empty table of this list
+		_list = std::move(rhs._list);
+		std::swap(_table, rhs._table);
+		std::swap(_mask, rhs._mask);
+		std::swap(_bits, rhs._bits);
+		return *this;
+	}
+
+	// objects are moved to nodes of this list one by one, index them all without growing
+	unsigned cap = 8;
+	while (cap < rhs._list._size * 2)
+		cap *= 2;
+
+	// no memory for the index, rhs is left intact
+	if (cap > (_table ? _mask + 1 : 0) && !_rehash(cap))
+		return *this;
+
+	while (rhs._list._size){
+		// key of the object is needed to unindex it, so it's done before the move
+		rhs._eraseIndex(rhs._list.root);
+		if (!_list.emplace_back(std::move(rhs._list.root->data))){
+			// allocator has no free nodes, objects left stay in rhs
+			rhs._insertIndex(rhs._list.root);
+			break;
+		}
+		_insertIndex(_list.last);
+		rhs._list._shift();
+	}
+
+	return *this;
+}
@@ -0,0 +1,560 @@
+/*
+	IndexedLinkedList.h - Generic list with O(log n) positional access
+	Shares LinkedList API, implemented as an indexable skip list:
+	each node has a random number of forward links, every link keeps
+	the number of elements it skips over, so get/set/add/remove by index
+	are O(log n) on average regardless of access pattern
+
+	For instructions, go to https://github.com/vortigont/LinkedList
+*/
+
+#pragma once
+
+#include "LinkedList.h"
+#include <stdint.h>
+
+template<class T> struct SkipNode;
+
+template<class T>
+struct SkipLink
+{
+	SkipNode<T> *next;
+	// distance to the next node in elements
+	unsigned span;
+};
+
+/*
+	Skip list node
+	level 0 link is inherited, so nodes chain is walked via 'next' like ListNode,
+	links for upper levels are allocated right after the node
+*/
+template<class T>
+struct SkipNode : public SkipLink<T>
+{
+	T data;
+	unsigned char level;
+
+	template<class... Args>
+	SkipNode(ListNodeEmplace, unsigned char _level, Args&&... args) : data(std::forward<Args>(args)...), level(_level) {}
+
+	SkipLink<T>& link(unsigned l){ return l ? reinterpret_cast<SkipLink<T>*>(this + 1)[l - 1] : *this; }
+};
+
+template <typename T>
+class IndexedLinkedList{
+
+protected:
+	static const unsigned MaxLevel = 16;
+
+	unsigned _size = 0;
+	// number of levels in use
+	unsigned _level = 1;
+	// head links for each level
+	SkipLink<T> _head[MaxLevel];
+	SkipNode<T> *last = nullptr;
+	// random generator state for node levels
+	uint32_t _seed = 2463534242u;
+
+	// links of node x at level l, nullptr x is the head
+	SkipLink<T>& _link(SkipNode<T> *x, unsigned l){ return x ? x->link(l) : _head[l]; }
+
+	// node at index
+	SkipNode<T>* getNode(unsigned index) const;
+
+	/**
+	 * @brief find nodes preceding index at each level
+	 * @param update - predecessors per level, nullptr for the head
+	 * @param rank - position of each predecessor, 0 for the head, element index + 1 for nodes
+	 */
+	void _findPrev(unsigned index, SkipNode<T> **update, unsigned *rank);
+
+	// random level with p=1/4
+	unsigned char _randomLevel();
+
+	// delete node, it must be unlinked already
+	void _freeNode(SkipNode<T> *node);
+
+	// unlink and delete node at index
+	void _erase(unsigned index);
+
+	/**
+	 * @brief sort nodes with a 'less' predicate
+	 */
+	template<class Less>
+	void _sort(Less &&less);
+
+public:
+	IndexedLinkedList();
+	IndexedLinkedList(unsigned sizeIndex, const T& _t); //initiate list size and default value
+	IndexedLinkedList(const IndexedLinkedList &rhs) : IndexedLinkedList(){ *this = rhs; };	// clone constructor
+	IndexedLinkedList(IndexedLinkedList &&rhs) : IndexedLinkedList(){ *this = std::move(rhs); };	// move constructor
+	~IndexedLinkedList(){ clear(); };
+
+	/*
+		Returns current size of IndexedLinkedList
+	*/
+	unsigned size() const { return _size; };
+
+	/*
+		Adds a T object in the specified index, O(log n);
+		Returns false if no memory for a new node
+	*/
+	bool add(unsigned index, const T& _t){ return emplace(index, _t); };
+	bool add(unsigned index, T&& _t){ return emplace(index, std::move(_t)); };
+
+	/*
+		Adds a T object in the end of the list;
+	*/
+	bool add(const T& _t){ return emplace(_size, _t); };
+	bool add(T&& _t){ return emplace(_size, std::move(_t)); };
+
+	/*
+		Adds a T object in the start of the list;
+	*/
+	bool unshift(const T& _t){ return emplace(0, _t); };
+	bool unshift(T&& _t){ return emplace(0, std::move(_t)); };
+
+	/*
+		Set the object at index, with T;
+	*/
+	bool set(unsigned index, const T& _t);
+	bool set(unsigned index, T&& _t);
+
+	/**
+	 * @brief construct T object in-place from args at the specified index
+	 */
+	template<class... Args>
+	bool emplace(unsigned index, Args&&... args);
+
+	template<class... Args>
+	bool emplace_back(Args&&... args){ return emplace(_size, std::forward<Args>(args)...); };
+
+	template<class... Args>
+	bool emplace_front(Args&&... args){ return emplace(0, std::forward<Args>(args)...); };
+
+	/*
+		Remove node at index, O(log n);
+		Returns T object moved out of removed node or T() if index is not reachable
+	*/
+	T remove(unsigned index);
+
+	/*
+		Unlink and delete node at index;
+	*/
+	void unlink(unsigned index){ if (index < _size) _erase(index); };
+
+	/*
+		Remove last object;
+		Returns T object moved out of removed node
+	*/
+	T pop(){ return _size ? remove(_size - 1) : T(); };
+
+	/**
+	 * @brief 		Remove first object
+	 *	Returns T object moved out of removed node
+	 */
+	T shift(){ return remove(0); };
+
+	/*
+		Get the index'th element on the list, O(log n);
+		Return Element if accessible,
+		else, return T();
+	*/
+	T get(unsigned index) const;
+
+	// Get first element of the list or T() if list is empty
+	T front() const { return _size ? _head[0].next->data : T(); };
+
+	// Get last element of the list or T() if list is empty
+	T back() const { return _size ? last->data : T(); };
+
+	// same as front()
+	T head() const { return front(); }
+
+	// same as back()
+	T tail() const { return back(); }
+
+	/*
+		Return true if element with specified index exist
+	*/
+	bool exist(unsigned index) const { return index < _size; };
+
+	/**
+	 * @brief clear the list
+	 * NOTE: same as LinkedList::clear() stored pointers are not deleted
+	 */
+	void clear();
+
+	/*
+		Sort the list, given a comparison function
+		nodes keep their levels, links are rebuilt in one pass
+	*/
+	void sort(int (*cmp)(T &, T &));
+
+	/**
+	 * @brief sort the list with any callable: function, functor or lambda
+	 * stable, see LinkedList::sort(Compare&&)
+	 */
+	template<class Compare = std::less<> >
+	void sort(Compare &&cmp = Compare());
+
+	inline T& operator[](unsigned i) { return getNode(i)->data; }
+	inline const T& operator[](const unsigned i) const { return getNode(i)->data; }
+
+	// deep-copy via assign operator
+	IndexedLinkedList & operator =(const IndexedLinkedList &rhs);
+
+	// move assignment, takes over nodes of rhs
+	IndexedLinkedList & operator =(IndexedLinkedList &&rhs);
+
+	/*
+		ConstIterator class
+		provides immutable forward iterator for the list
+	*/
+	struct ConstIterator {
+		using iterator_category = std::forward_iterator_tag;
+		using difference_type   = std::ptrdiff_t;
+		using value_type        = T;
+		using pointer           = const T*;
+		using reference         = const T&;
+
+		ConstIterator(SkipNode<T> *ptr = nullptr) : m_ptr(ptr) {}
+
+		reference operator*() const { return m_ptr->data; }
+		pointer operator->() const { return &m_ptr->data; }
+
+		// Prefix increment
+		ConstIterator& operator++() { m_ptr = m_ptr->next; return *this; }
+
+		// Postfix increment
+		ConstIterator operator++(int) { ConstIterator tmp = *this; m_ptr = m_ptr->next; return tmp; }
+
+		bool operator== (const ConstIterator& a) const { return m_ptr == a.m_ptr; };
+		bool operator!= (const ConstIterator& a) const { return m_ptr != a.m_ptr; };
+
+		protected:
+			SkipNode<T> *m_ptr;
+	};
+
+	/*
+		Iterator class
+		inherits from ConstIterator, provides mutable forward iterator for the list
+	*/
+	struct Iterator : public ConstIterator {
+		using iterator_category = std::forward_iterator_tag;
+		using difference_type   = std::ptrdiff_t;
+		using value_type        = T;
+		using pointer           = T*;
+		using reference         = T&;
+
+		Iterator(SkipNode<T> *ptr = nullptr) : ConstIterator(ptr) {}
+
+		reference operator*() const { return this->m_ptr->data; }
+		pointer operator->() const { return &this->m_ptr->data; }
+
+		Iterator& operator++() { ConstIterator::operator++(); return *this; }
+		Iterator operator++(int) { Iterator tmp = *this; ++(*this); return tmp; }
+	};
+
+	// iterator methods
+	ConstIterator cbegin() const { return ConstIterator(_head[0].next); }
+	ConstIterator cend() const { return ConstIterator(nullptr); }
+	ConstIterator begin() const { return cbegin(); }
+	ConstIterator end() const { return cend(); }
+	Iterator begin() { return Iterator(_head[0].next); }
+	Iterator end() { return Iterator(nullptr); }
+};
+
+
+template<typename T>
+IndexedLinkedList<T>::IndexedLinkedList(){
+	for (unsigned l = 0; l != MaxLevel; ++l){
+		_head[l].next = nullptr;
+		_head[l].span = 1;
+	}
+}
+
+template<typename T>
+IndexedLinkedList<T>::IndexedLinkedList(unsigned sizeIndex, const T& _t) : IndexedLinkedList() {
+	for (unsigned i = 0; i < sizeIndex; i++){
+		add(_t);
+	}
+}
+
+template<typename T>
+unsigned char IndexedLinkedList<T>::_randomLevel(){
+	// xorshift32
+	_seed ^= _seed << 13;
+	_seed ^= _seed >> 17;
+	_seed ^= _seed << 5;
+
+	uint32_t r = _seed;
+	unsigned char lvl = 1;
+	while (lvl < MaxLevel && !(r & 3)){
+		++lvl;
+		r >>= 2;
+	}
+	return lvl;
+}
+
+template<typename T>
+SkipNode<T>* IndexedLinkedList<T>::getNode(unsigned index) const {
+	if (index >= _size)
+		return nullptr;
+
+	if (index == _size - 1)
+		return last;
+
+	// rank of the element is it's index + 1, head has rank 0
+	const unsigned rank = index + 1;
+	unsigned pos = 0;
+	SkipNode<T> *node = nullptr;
+
+	for (unsigned l = _level; l--; ){
+		const SkipLink<T> *lnk = node ? &node->link(l) : &_head[l];
+		while (lnk->next && pos + lnk->span <= rank){
+			pos += lnk->span;
+			node = lnk->next;
+			lnk = &node->link(l);
+		}
+		if (pos == rank)
+			break;
+	}
+
+	return node;
+}
+
+template<typename T>
+void IndexedLinkedList<T>::_findPrev(unsigned index, SkipNode<T> **update, unsigned *rank){
+	SkipNode<T> *x = nullptr;
+	unsigned pos = 0;
+
+	for (unsigned l = _level; l--; ){
+		SkipLink<T> *lnk = &_link(x, l);
+		while (lnk->next && pos + lnk->span <= index){
+			pos += lnk->span;
+			x = lnk->next;
+			lnk = &x->link(l);
+		}
+		update[l] = x;
+		rank[l] = pos;
+	}
+}
+
+template<typename T>
+template<class... Args>
+bool IndexedLinkedList<T>::emplace(unsigned index, Args&&... args){
+	if (index > _size)
+		index = _size;
+
+	SkipNode<T> *update[MaxLevel];
+	unsigned rank[MaxLevel];
+	_findPrev(index, update, rank);
+
+	unsigned char lvl = _randomLevel();
+
+	void *mem = ::operator new(sizeof(SkipNode<T>) + (lvl - 1) * sizeof(SkipLink<T>), std::nothrow);
+	if (!mem)
+		return false;
+
+	SkipNode<T> *node = new (mem) SkipNode<T>(ListNodeEmplace(), lvl, std::forward<Args>(args)...);
+
+	if (lvl > _level){
+		// new levels start from the head and point to the end of the list
+		for (unsigned l = _level; l != lvl; ++l){
+			update[l] = nullptr;
+			rank[l] = 0;
+			_head[l].next = nullptr;
+			_head[l].span = _size + 1;
+		}
+		_level = lvl;
+	}
+
+	// new node rank
+	const unsigned pos = index + 1;
+	for (unsigned l = 0; l != lvl; ++l){
+		SkipLink<T> &prev = _link(update[l], l);
+		SkipLink<T> &lnk = node->link(l);
+		lnk.next = prev.next;
+		lnk.span = prev.span + 1 - (pos - rank[l]);
+		prev.next = node;
+		prev.span = pos - rank[l];
+	}
+
+	// links above new node's level now jump over one more element
+	for (unsigned l = lvl; l < _level; ++l)
+		++_link(update[l], l).span;
+
+	if (!node->next)
+		last = node;
+
+	++_size;
+	return true;
+}
+
+template<typename T>
+void IndexedLinkedList<T>::_freeNode(SkipNode<T> *node){
+	node->~SkipNode();
+	::operator delete(node);
+}
+
+template<typename T>
+void IndexedLinkedList<T>::_erase(unsigned index){
+	SkipNode<T> *update[MaxLevel];
+	unsigned rank[MaxLevel];
+	_findPrev(index, update, rank);
+
+	SkipNode<T> *node = _link(update[0], 0).next;
+
+	for (unsigned l = 0; l != _level; ++l){
+		SkipLink<T> &prev = _link(update[l], l);
+		if (prev.next == node){
+			SkipLink<T> &lnk = node->link(l);
+			prev.span += lnk.span - 1;
+			prev.next = lnk.next;
+		} else
+			--prev.span;
+	}
+
+	if (last == node)
+		last = update[0];
+
+	_freeNode(node);
+	--_size;
+
+	while (_level > 1 && !_head[_level - 1].next)
+		--_level;
+}
+
+template<typename T>
+bool IndexedLinkedList<T>::set(unsigned index, const T& _t){
+	if(index >= _size)
+		return false;
+
+	getNode(index)->data = _t;
+	return true;
+}
+
+template<typename T>
+bool IndexedLinkedList<T>::set(unsigned index, T&& _t){
+	if(index >= _size)
+		return false;
+
+	getNode(index)->data = std::move(_t);
+	return true;
+}
+
+template<typename T>
+T IndexedLinkedList<T>::remove(unsigned index){
+	if (index >= _size)
+		return T();
+
+	T ret(std::move(getNode(index)->data));
+	_erase(index);
+	return ret;
+}
+
+template<typename T>
+T IndexedLinkedList<T>::get(unsigned index) const {
+	SkipNode<T> *node = getNode(index);
+
+	return (node ? node->data : T());
+}
+
+template<typename T>
+void IndexedLinkedList<T>::clear(){
+	SkipNode<T> *node = _head[0].next;
+	while (node){
+		SkipNode<T> *_next = node->next;
+		_freeNode(node);
+		node = _next;
+	}
+
+	for (unsigned l = 0; l != MaxLevel; ++l){
+		_head[l].next = nullptr;
+		_head[l].span = 1;
+	}
+
+	last = nullptr;
+	_size = 0;
+	_level = 1;
+}
+
+template<typename T>
+void IndexedLinkedList<T>::sort(int (*cmp)(T &, T &)){
+	_sort(llist::make_less<T>(cmp));
+}
+
+template<typename T>
+template<class Compare>
+void IndexedLinkedList<T>::sort(Compare &&cmp){
+	_sort(llist::make_less<T>(cmp));
+}
+
+template<typename T>
+template<class Less>
+void IndexedLinkedList<T>::_sort(Less &&less){
+	if(_size < 2) return; // trivial case;
+
+	last = llist::sort_chain(_head[0].next, less);
+
+	// relink all levels in the new order, nodes keep their levels
+	SkipLink<T> *tails[MaxLevel];
+	unsigned tailRank[MaxLevel];
+	for (unsigned l = 0; l != _level; ++l){
+		tails[l] = &_head[l];
+		tailRank[l] = 0;
+	}
+
+	unsigned pos = 0;
+	for (SkipNode<T> *node = _head[0].next; node; node = node->next){
+		++pos;
+		for (unsigned l = 0; l != node->level; ++l){
+			tails[l]->next = node;
+			tails[l]->span = pos - tailRank[l];
+			tails[l] = &node->link(l);
+			tailRank[l] = pos;
+		}
+	}
+
+	for (unsigned l = 0; l != _level; ++l){
+		tails[l]->next = nullptr;
+		tails[l]->span = _size + 1 - tailRank[l];
+	}
+}
+
+template<typename T>
+IndexedLinkedList<T>& IndexedLinkedList<T>::operator =(const IndexedLinkedList& rhs) {
+	if (this == &rhs)
+		return *this;
+
+	clear();
+	for (const auto& i : rhs)
+		add(i);
+
+	return *this;
+}
+
+template<typename T>
+IndexedLinkedList<T>& IndexedLinkedList<T>::operator =(IndexedLinkedList&& rhs) {
+	if (this == &rhs)
+		return *this;
+
+	clear();
+
+	for (unsigned l = 0; l != MaxLevel; ++l){
+		_head[l] = rhs._head[l];
+		rhs._head[l].next = nullptr;
+		rhs._head[l].span = 1;
+	}
+
+	_size = rhs._size;
+	_level = rhs._level;
+	last = rhs.last;
+
+	rhs._size = 0;
+	rhs._level = 1;
+	rhs.last = nullptr;
+
+	return *this;
+}
@@ -0,0 +1,389 @@
+/*
+	IntrusiveLinkedList.h - Linked list of caller-owned objects
+	Link pointer lives inside of the object itself (IntrusiveHook member),
+	so the list never allocates, copies or destructs anything,
+	it only links and unlinks objects which are stored elsewhere.
+
+	An object could be linked to several lists at once via different hooks,
+	but must not be linked twice with the same hook.
+	Object must stay alive and not be moved while it is in a list.
+
+	For instructions, go to https://github.com/vortigont/LinkedList
+*/
+
+#pragma once
+
+#include "LinkedList.h"
+
+/**
+ * @brief link member to be embedded into objects of intrusive list
+ */
+template<class T>
+struct IntrusiveHook
+{
+	T *next = nullptr;
+};
+
+template <typename T, IntrusiveHook<T> T::*Hook>
+class IntrusiveLinkedList{
+
+protected:
+	unsigned _size = 0;
+	T *root = nullptr;
+	T *last = nullptr;
+
+	// Helps "get" method, by saving last position
+	mutable T *lastNodeGot = nullptr;
+	mutable unsigned lastIndexGot = 0;
+
+	// node access for llist::sort_chain()
+	struct Links {
+		static T*& next(T *obj){ return (obj->*Hook).next; }
+		static T& data(T *obj){ return *obj; }
+	};
+
+	static T*& _next(T *obj){ return (obj->*Hook).next; }
+
+	T* getNode(unsigned index) const;
+
+	/**
+	 * @brief unlink the object next to prev (or root if prev is nullptr)
+	 * @param prevIndex - index of prev node, node cache is set to it
+	 */
+	T* _unlinkAfter(T *prev, unsigned prevIndex);
+
+	/**
+	 * @brief sort objects with a 'less' predicate
+	 */
+	template<class Less>
+	void _sort(Less &&less);
+
+public:
+	IntrusiveLinkedList(){};
+	// objects could not be linked to two lists with the same hook, so there is no copy
+	IntrusiveLinkedList(const IntrusiveLinkedList&) = delete;
+	IntrusiveLinkedList& operator=(const IntrusiveLinkedList&) = delete;
+	IntrusiveLinkedList(IntrusiveLinkedList &&rhs){ *this = std::move(rhs); };
+	IntrusiveLinkedList& operator=(IntrusiveLinkedList &&rhs);
+	// unlinks all objects, objects themselves are not touched
+	~IntrusiveLinkedList(){ clear(); };
+
+	/*
+		Returns current size of the list
+	*/
+	unsigned size() const { return _size; };
+
+	/*
+		Links an object at the specified index (to the end if index >= size);
+		object must not be linked with the same hook already
+	*/
+	bool add(unsigned index, T &obj);
+
+	/*
+		Links an object to the end of the list, O(1)
+	*/
+	bool add(T &obj);
+
+	/*
+		Links an object to the start of the list, O(1)
+	*/
+	bool unshift(T &obj);
+
+	/*
+		Unlink object at index;
+		Returns pointer to the unlinked object or nullptr if index is not reachable
+	*/
+	T* remove(unsigned index);
+
+	// unlink object at index
+	void unlink(unsigned index){ remove(index); };
+
+	/**
+	 * @brief unlink the object wherever it is in the list, O(n)
+	 * @return false if object is not in the list
+	 */
+	bool unlink(T &obj);
+
+	/*
+		Unlink last object, O(n);
+		Returns pointer to the object or nullptr if list is empty
+	*/
+	T* pop();
+
+	/*
+		Unlink first object, O(1);
+		Returns pointer to the object or nullptr if list is empty
+	*/
+	T* shift();
+
+	/*
+		Get the index'th object on the list;
+		Returns pointer to the object or nullptr if index is not reachable
+	*/
+	T* get(unsigned index) const { return getNode(index); };
+
+	T* front() const { return root; };
+	T* back() const { return last; };
+
+	bool exist(unsigned index) const { return index < _size; };
+
+	/**
+	 * @brief unlink all objects
+	 */
+	void clear();
+
+	/*
+		Sort the list, given a comparison function
+	*/
+	void sort(int (*cmp)(T &, T &));
+
+	/**
+	 * @brief sort the list with any callable: function, functor or lambda
+	 * stable, see LinkedList::sort(Compare&&)
+	 */
+	template<class Compare = std::less<> >
+	void sort(Compare &&cmp = Compare());
+
+	inline T& operator[](unsigned i) { return *getNode(i); }
+	inline const T& operator[](const unsigned i) const { return *getNode(i); }
+
+	/*
+		ConstIterator class
+		provides immutable forward iterator for the list,
+		next object is fetched in advance, so current one could be unlinked while iterating
+	*/
+	struct ConstIterator {
+		using iterator_category = std::forward_iterator_tag;
+		using difference_type   = std::ptrdiff_t;
+		using value_type        = T;
+		using pointer           = const T*;
+		using reference         = const T&;
+
+		ConstIterator(T *ptr = nullptr) : m_ptr(ptr), m_next_ptr(ptr ? _next(ptr) : nullptr) {}
+
+		reference operator*() const { return *m_ptr; }
+		pointer operator->() const { return m_ptr; }
+
+		// Prefix increment
+		ConstIterator& operator++() { m_ptr = m_next_ptr; m_next_ptr = m_ptr ? _next(m_ptr) : nullptr; return *this; }
+
+		// Postfix increment
+		ConstIterator operator++(int) { ConstIterator tmp = *this; ++(*this); return tmp; }
+
+		bool operator== (const ConstIterator& a) const { return m_ptr == a.m_ptr; };
+		bool operator!= (const ConstIterator& a) const { return m_ptr != a.m_ptr; };
+
+		protected:
+			T *m_ptr;
+			T *m_next_ptr;
+	};
+
+	/*
+		Iterator class
+		inherits from ConstIterator, provides mutable forward iterator for the list
+	*/
+	struct Iterator : public ConstIterator {
+		using iterator_category = std::forward_iterator_tag;
+		using difference_type   = std::ptrdiff_t;
+		using value_type        = T;
+		using pointer           = T*;
+		using reference         = T&;
+
+		Iterator(T *ptr = nullptr) : ConstIterator(ptr) {}
+
+		reference operator*() const { return *this->m_ptr; }
+		pointer operator->() const { return this->m_ptr; }
+
+		Iterator& operator++() { ConstIterator::operator++(); return *this; }
+		Iterator operator++(int) { Iterator tmp = *this; ++(*this); return tmp; }
+	};
+
+	// iterator methods
+	ConstIterator cbegin() const { return ConstIterator(root); }
+	ConstIterator cend() const { return ConstIterator(nullptr); }
+	ConstIterator begin() const { return cbegin(); }
+	ConstIterator end() const { return cend(); }
+	Iterator begin() { return Iterator(root); }
+	Iterator end() { return Iterator(nullptr); }
+};
+
+
+template<typename T, IntrusiveHook<T> T::*Hook>
+T* IntrusiveLinkedList<T, Hook>::getNode(unsigned index) const {
+	if (index >= _size)
+		return nullptr;
+
+	if (!index)
+		return root;
+
+	if (index == _size - 1)
+		return last;
+
+	unsigned _pos = 0;
+	T *current = root;
+
+	if (lastIndexGot <= index){
+		_pos = lastIndexGot;
+		current = lastNodeGot;
+	}
+
+	while (_pos < index){
+		current = _next(current);
+		++_pos;
+	}
+
+	lastIndexGot = index;
+	lastNodeGot = current;
+	return current;
+}
+
+template<typename T, IntrusiveHook<T> T::*Hook>
+bool IntrusiveLinkedList<T, Hook>::add(unsigned index, T &obj){
+	if (index >= _size)
+		return add(obj);
+
+	if (!index)
+		return unshift(obj);
+
+	T *prev = getNode(index - 1);
+	_next(&obj) = _next(prev);
+	_next(prev) = &obj;
+	++_size;
+
+	lastNodeGot = &obj;
+	lastIndexGot = index;
+	return true;
+}
+
+template<typename T, IntrusiveHook<T> T::*Hook>
+bool IntrusiveLinkedList<T, Hook>::add(T &obj){
+	_next(&obj) = nullptr;
+
+	if (root)
+		_next(last) = &obj;
+	else
+		root = &obj;
+
+	last = &obj;
+	++_size;
+
+	lastNodeGot = last;
+	lastIndexGot = _size - 1;
+	return true;
+}
+
+template<typename T, IntrusiveHook<T> T::*Hook>
+bool IntrusiveLinkedList<T, Hook>::unshift(T &obj){
+	_next(&obj) = root;
+	root = &obj;
+	if (!last)
+		last = root;
+	++_size;
+
+	lastNodeGot = root;
+	lastIndexGot = 0;
+	return true;
+}
+
+template<typename T, IntrusiveHook<T> T::*Hook>
+T* IntrusiveLinkedList<T, Hook>::_unlinkAfter(T *prev, unsigned prevIndex){
+	T *obj = prev ? _next(prev) : root;
+
+	if (prev)
+		_next(prev) = _next(obj);
+	else
+		root = _next(obj);
+
+	if (last == obj)
+		last = prev;
+
+	_next(obj) = nullptr;
+	--_size;
+
+	lastNodeGot = prev ? prev : root;
+	lastIndexGot = prev ? prevIndex : 0;
+	return obj;
+}
+
+template<typename T, IntrusiveHook<T> T::*Hook>
+T* IntrusiveLinkedList<T, Hook>::remove(unsigned index){
+	if (index >= _size)
+		return nullptr;
+
+	return index ? _unlinkAfter(getNode(index - 1), index - 1) : _unlinkAfter(nullptr, 0);
+}
+
+template<typename T, IntrusiveHook<T> T::*Hook>
+bool IntrusiveLinkedList<T, Hook>::unlink(T &obj){
+	T *prev = nullptr;
+	unsigned index = 0;
+	for (T *node = root; node; prev = node, node = _next(node), ++index){
+		if (node == &obj){
+			_unlinkAfter(prev, index - 1);
+			return true;
+		}
+	}
+
+	return false;
+}
+
+template<typename T, IntrusiveHook<T> T::*Hook>
+T* IntrusiveLinkedList<T, Hook>::pop(){
+	return _size ? remove(_size - 1) : nullptr;
+}
+
+template<typename T, IntrusiveHook<T> T::*Hook>
+T* IntrusiveLinkedList<T, Hook>::shift(){
+	return _size ? _unlinkAfter(nullptr, 0) : nullptr;
+}
+
+template<typename T, IntrusiveHook<T> T::*Hook>
+void IntrusiveLinkedList<T, Hook>::clear(){
+	while (root){
+		T *_n = _next(root);
+		_next(root) = nullptr;
+		root = _n;
+	}
+
+	last = lastNodeGot = nullptr;
+	_size = lastIndexGot = 0;
+}
+
+template<typename T, IntrusiveHook<T> T::*Hook>
+void IntrusiveLinkedList<T, Hook>::sort(int (*cmp)(T &, T &)){
+	_sort(llist::make_less<T>(cmp));
+}
+
+template<typename T, IntrusiveHook<T> T::*Hook>
+template<class Compare>
+void IntrusiveLinkedList<T, Hook>::sort(Compare &&cmp){
+	_sort(llist::make_less<T>(cmp));
+}
+
+template<typename T, IntrusiveHook<T> T::*Hook>
+template<class Less>
+void IntrusiveLinkedList<T, Hook>::_sort(Less &&less){
+	if (_size < 2) return; // trivial case;
+
+	last = llist::sort_chain(root, less, Links());
+	lastNodeGot = root;
+	lastIndexGot = 0;
+}
+
+template<typename T, IntrusiveHook<T> T::*Hook>
+IntrusiveLinkedList<T, Hook>& IntrusiveLinkedList<T, Hook>::operator=(IntrusiveLinkedList &&rhs){
+	if (this == &rhs)
+		return *this;
+
+	clear();
+	root = rhs.root;
+	last = rhs.last;
+	_size = rhs._size;
+	lastNodeGot = rhs.lastNodeGot;
+	lastIndexGot = rhs.lastIndexGot;
+
+	rhs.root = rhs.last = rhs.lastNodeGot = nullptr;
+	rhs._size = rhs.lastIndexGot = 0;
+
+	return *this;
+}
@@ -16,13 +16,48 @@
 
 #ifndef LList_h
 #define LList_h
+#include <algorithm>
+#include <functional>
 #include <iterator>
+#include <new>
+#include <type_traits>
+#include <utility>
+#include <stdint.h>
+#ifdef LINKEDLIST_STATS
+#include <stdio.h>
+#endif
 
 namespace LL{ 
 #include <LinkedList.h>
+#include <DLinkedList.h>
+#include <UnrolledLinkedList.h>
+#include <IndexedLinkedList.h>
+#include <IntrusiveLinkedList.h>
+#include <StaticLinkedList.h>
+#include <CompactLinkedList.h>
+#include <HashedLinkedList.h>
+#include <SortedLinkedList.h>
+#include <RingBufferList.h>
 }
 
 
 template<typename T> using LNode = LL::ListNode<T>;
-template<typename T> using LList = LL::LinkedList<T>;
+using LListOverflow = LL::ListOverflow;
+template<typename T, class Alloc = LL::NodeHeapAllocator< LL::ListNode<T> > > using LList = LL::LinkedList<T, Alloc>;
+template<typename T, class Alloc = LL::NodeHeapAllocator< LL::ListNode<T> > > using LListCore = LL::LinkedListCore<T, Alloc>;
+template<typename Node, size_t N> using LNodePool = LL::NodePool<Node, N>;
+template<typename T, size_t N> using LPooledList = LL::PooledLinkedList<T, N>;
+template<typename T> using LCachedList = LL::CachedLinkedList<T>;
+template<typename T> using LSlabList = LL::SlabLinkedList<T>;
+template<typename T> using LDNode = LL::DListNode<T>;
+template<typename T, class Alloc = LL::NodeHeapAllocator< LL::DListNode<T> > > using LDList = LL::DLinkedList<T, Alloc>;
+template<typename T, unsigned N = 8, class Alloc = LL::NodeHeapAllocator< LL::UnrolledNode<T, N> > > using LUList = LL::UnrolledLinkedList<T, N, Alloc>;
+template<typename T> using LIList = LL::IndexedLinkedList<T>;
+template<typename T, size_t N> using LStaticList = LL::StaticLinkedList<T, N>;
+template<typename T, typename SizeT = uint16_t, class Alloc = LL::NodeHeapAllocator< LL::ListNode<T> > > using LCompactList = LL::CompactLinkedList<T, SizeT, Alloc>;
+template<typename T, class KeyOf, class Hash = std::hash< typename LL::HashedLinkedList<T, KeyOf>::key_type > > using LHashedList = LL::HashedLinkedList<T, KeyOf, Hash>;
+template<typename T, class Compare = std::less<> > using LSortedList = LL::SortedLinkedList<T, Compare>;
+template<typename T, size_t N = 0> using LRingList = LL::RingBufferList<T, N>;
+template<typename T> using LHook = LL::IntrusiveHook<T>;
+template<typename T, LL::IntrusiveHook<T> T::*Hook> using LIntrusiveList = LL::IntrusiveLinkedList<T, Hook>;
 #endif
\ No newline at end of file
@@ -12,7 +12,26 @@
 #pragma once
 
 #include <stddef.h>
+#include <functional>
 #include <iterator>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+/*
+	Define LINKEDLIST_STATS before including the library (or with -DLINKEDLIST_STATS)
+	to count node accesses, allocations and sort comparisons of every list, see LinkedListCore::stats().
+	Without it counters do not exist and cost nothing
+*/
+#ifdef LINKEDLIST_STATS
+#include <stdio.h>
+#define LINKEDLIST_STAT(expr) (expr)
+#else
+#define LINKEDLIST_STAT(expr) ((void)0)
+#endif
+
+// tag type to select ListNode's in-place constructor
+struct ListNodeEmplace {};
 
 template<class T>
 struct ListNode
@@ -20,14 +39,513 @@ struct ListNode
 	T data;
 	ListNode<T> *next;
 
-	ListNode<T>(ListNode<T>* _next = nullptr) : next(_next) {}
-	ListNode<T>(const T& _v, ListNode<T>* _next = nullptr) : data(_v), next(_next) {}
+	ListNode(ListNode<T>* _next = nullptr) : next(_next) {}
+	ListNode(const T& _v, ListNode<T>* _next = nullptr) : data(_v), next(_next) {}
+	ListNode(T&& _v, ListNode<T>* _next = nullptr) : data(std::move(_v)), next(_next) {}
+
+	// construct data object in-place from arbitrary args
+	template<class... Args>
+	ListNode(ListNodeEmplace, ListNode<T>* _next, Args&&... args) : data(std::forward<Args>(args)...), next(_next) {}
+};
+
+/**
+ * @brief default node allocator
+ * takes memory for each node from the heap and returns it back on node removal
+ */
+template<class Node>
+struct NodeHeapAllocator {
+	// any instance is able to release a node allocated by any other instance
+	static constexpr bool is_always_equal = true;
+
+	Node* allocate(){ return static_cast<Node*>(::operator new(sizeof(Node), std::nothrow)); }
+	void deallocate(Node *n){ ::operator delete(n); }
+};
+
+/**
+ * @brief fixed-capacity node pool
+ * keeps storage for N nodes inline, released nodes are kept in a free-list
+ * and handed out again, so no heap calls are made at all.
+ * Storage lives within the list object, so a global/static list gets a static pool
+ * allocate() returns nullptr when pool is exhausted, list's add() will return false then
+ */
+template<class Node, size_t N>
+class NodePool {
+	union Slot {
+		Slot *next;
+		alignas(Node) unsigned char node[sizeof(Node)];
+	};
+
+	Slot _slots[N];
+	// head of released slots chain
+	Slot *_free = nullptr;
+	// slots above this index were never used yet, saves pre-linking whole pool on construction
+	size_t _top = 0;
+	size_t _used = 0;
+
+public:
+	// nodes could be released only to the pool they were taken from
+	static constexpr bool is_always_equal = false;
+
+	NodePool(){}
+	NodePool(const NodePool&) = delete;
+	NodePool& operator=(const NodePool&) = delete;
+
+	Node* allocate(){
+		Slot *s;
+		if (_free){
+			s = _free;
+			_free = s->next;
+		} else if (_top < N){
+			s = &_slots[_top++];
+		} else
+			return nullptr;
+
+		++_used;
+		return reinterpret_cast<Node*>(s->node);
+	}
+
+	void deallocate(Node *n){
+		Slot *s = reinterpret_cast<Slot*>(n);
+		s->next = _free;
+		_free = s;
+		--_used;
+	}
+
+	// total number of nodes in a pool
+	size_t capacity() const { return N; }
+
+	// number of nodes that could still be allocated
+	size_t available() const { return N - _used; }
+};
+
+/**
+ * @brief heap node allocator keeping released nodes for reuse
+ * nodes released by the list (shift/pop/unlink/clear) are kept in a free chain up to a limit
+ * and handed out again, so a queue oscillating around a constant depth makes no heap calls
+ * after warm-up. Cached nodes are returned to the heap by shrink_to_fit() or on destruction
+ */
+template<class Node>
+class NodeCacheAllocator {
+	struct Slot {
+		Slot *next;
+	};
+	static_assert(sizeof(Node) >= sizeof(Slot), "node must fit a free chain link");
+
+	// head of cached nodes chain
+	Slot *_free = nullptr;
+	size_t _cached = 0;
+	size_t _limit = static_cast<size_t>(-1);
+
+	void _push(Node *n){ _free = new (n) Slot{_free}; ++_cached; }
+
+public:
+	// all nodes come from the heap, so any instance could take any node
+	static constexpr bool is_always_equal = true;
+
+	NodeCacheAllocator(){}
+	NodeCacheAllocator(const NodeCacheAllocator&) = delete;
+	NodeCacheAllocator& operator=(const NodeCacheAllocator&) = delete;
+	~NodeCacheAllocator(){ shrink_to_fit(); }
+
+	Node* allocate(){
+		if (!_free)
+			return static_cast<Node*>(::operator new(sizeof(Node), std::nothrow));
+
+		Slot *s = _free;
+		_free = s->next;
+		--_cached;
+		return reinterpret_cast<Node*>(s);
+	}
+
+	void deallocate(Node *n){
+		if (_cached < _limit)
+			_push(n);
+		else
+			::operator delete(n);
+	}
+
+	/**
+	 * @brief allocate nodes from the heap until n nodes are cached
+	 * no more than setLimit() nodes are cached, the rest is allocated on demand
+	 * @return false if there is no memory or n is over the limit
+	 */
+	bool reserve(size_t n){
+		bool fits = n <= _limit;
+		if (!fits)
+			n = _limit;
+
+		while (_cached < n){
+			Node *node = static_cast<Node*>(::operator new(sizeof(Node), std::nothrow));
+			if (!node)
+				return false;
+			_push(node);
+		}
+		return fits;
+	}
+
+	// return all cached nodes to the heap
+	void shrink_to_fit(){
+		while (_free){
+			Slot *s = _free;
+			_free = s->next;
+			::operator delete(s);
+		}
+		_cached = 0;
+	}
+
+	// max number of cached nodes, extra nodes are returned to the heap
+	void setLimit(size_t limit){
+		_limit = limit;
+		while (_cached > _limit){
+			Slot *s = _free;
+			_free = s->next;
+			::operator delete(s);
+			--_cached;
+		}
+	}
+
+	// number of cached nodes
+	size_t cached() const { return _cached; }
+};
+
+/**
+ * @brief heap node allocator carving nodes from contiguous slabs
+ * a slab holds many nodes in one heap block, so nodes of a list built in one go lie in memory
+ * in list order, traversal is cache friendly and n nodes take one heap call and one block header.
+ * reserve(n) takes a slab for exactly the missing nodes, when out of nodes a slab of half
+ * the nodes taken so far is added. Released nodes are kept in a free chain for reuse,
+ * a slab returns to the heap by shrink_to_fit() once all of its nodes are released, or on destruction
+ */
+template<class Node>
+class NodeSlabAllocator {
+	union Slot {
+		Slot *next;
+		alignas(Node) unsigned char node[sizeof(Node)];
+	};
+
+	// slab header, nodes follow it within the same heap block
+	struct alignas(Slot) Slab {
+		Slab *next;
+		size_t count;
+
+		Slot* slots(){ return reinterpret_cast<Slot*>(this + 1); }
+		bool owns(const Slot *s){ return !std::less<const Slot*>()(s, slots()) && std::less<const Slot*>()(s, slots() + count); }
+	};
+
+	Slab *_slabs = nullptr;
+	// head of free nodes chain
+	Slot *_free = nullptr;
+	size_t _total = 0;
+	size_t _available = 0;
+
+	// smallest slab added on demand
+	static constexpr size_t min_slab = 4;
+
+	bool _addSlab(size_t n){
+		Slab *s = static_cast<Slab*>(::operator new(sizeof(Slab) + n * sizeof(Slot), std::nothrow));
+		if (!s)
+			return false;
+
+		s->next = _slabs;
+		s->count = n;
+		_slabs = s;
+
+		// chained from the end, so nodes are handed out in address order
+		Slot *slots = s->slots();
+		for (size_t i = n; i--; )
+			_free = new (&slots[i]) Slot{_free};
+		_total += n;
+		_available += n;
+		return true;
+	}
+
+	// drop nodes of a slab from the free chain if none of them is in use
+	bool _unchain(Slab *s){
+		size_t n = 0;
+		for (Slot *f = _free; f; f = f->next)
+			n += s->owns(f);
+		if (n != s->count)
+			return false;
+
+		for (Slot **p = &_free; *p; ){
+			if (s->owns(*p))
+				*p = (*p)->next;
+			else
+				p = &(*p)->next;
+		}
+		_total -= n;
+		_available -= n;
+		return true;
+	}
+
+public:
+	// nodes could be released only to the allocator owning their slab
+	static constexpr bool is_always_equal = false;
+
+	NodeSlabAllocator(){}
+	NodeSlabAllocator(const NodeSlabAllocator&) = delete;
+	NodeSlabAllocator& operator=(const NodeSlabAllocator&) = delete;
+	~NodeSlabAllocator(){
+		while (_slabs){
+			Slab *s = _slabs;
+			_slabs = s->next;
+			::operator delete(s);
+		}
+	}
+
+	Node* allocate(){
+		// on low memory fall back to a single node slab
+		if (!_free && !_addSlab(_total / 2 > min_slab ? _total / 2 : min_slab) && !_addSlab(1))
+			return nullptr;
+
+		Slot *s = _free;
+		_free = s->next;
+		--_available;
+		return reinterpret_cast<Node*>(s->node);
+	}
+
+	void deallocate(Node *n){
+		_free = new (n) Slot{_free};
+		++_available;
+	}
+
+	/**
+	 * @brief make sure n nodes are free, missing ones are taken in one slab
+	 * @return false if there is no memory
+	 */
+	bool reserve(size_t n){
+		return _available >= n || _addSlab(n - _available);
+	}
+
+	// return slabs with no nodes in use to the heap
+	void shrink_to_fit(){
+		for (Slab **p = &_slabs; *p; ){
+			Slab *s = *p;
+			if (_unchain(s)){
+				*p = s->next;
+				::operator delete(s);
+			} else
+				p = &s->next;
+		}
+	}
+
+	// total number of nodes in all slabs
+	size_t capacity() const { return _total; }
+
+	// number of nodes that could be allocated without heap calls
+	size_t available() const { return _available; }
+};
+
+/**
+ * Node chain algorithms shared by list containers
+ * works with any node type having 'data' and 'next' members
+ */
+namespace llist {
+
+/**
+ * @brief adapts strcmp-like comparator (returns <0, 0, >0) to a 'less' predicate
+ * comparator is called with arguments in the same order as they are stored in the list
+ */
+template<class Compare>
+struct ThreeWayLess {
+	Compare &cmp;
+
+	template<class A, class B>
+	bool operator()(A &x, B &y) const { return cmp(y, x) > 0; }
+};
+
+// true if Compare is a 'less' predicate returning bool, otherwise it's treated as strcmp-like comparator
+template<class T, class Compare>
+using is_less_predicate = std::is_same<decltype(std::declval<Compare&>()(std::declval<T&>(), std::declval<T&>())), bool>;
+
+/**
+ * @brief get a 'less' predicate for any comparator
+ * bool returning callables are used as-is, int returning ones are wrapped into ThreeWayLess
+ */
+template<class T, class Compare>
+typename std::enable_if<is_less_predicate<T, Compare>::value, Compare&>::type
+make_less(Compare &cmp){ return cmp; }
+
+template<class T, class Compare>
+typename std::enable_if<!is_less_predicate<T, Compare>::value, ThreeWayLess<Compare> >::type
+make_less(Compare &cmp){ return ThreeWayLess<Compare>{cmp}; }
+
+/**
+ * @brief access to the link and the object of a chain node
+ * default one is for node pointers with 'next' and 'data' members like ListNode.
+ * Other policies could use any handle type where value-initialized handle is a null link
+ */
+template<class NodePtr>
+struct ChainLinks {
+	static NodePtr& next(NodePtr node){ return node->next; }
+	static auto data(NodePtr node) -> decltype((node->data)) { return node->data; }
+};
+
+/**
+ * @brief merge two sorted null-terminated chains, nodes of chain a go first if equal
+ * runs which are already in order or in reverse order are concatenated in O(1)
+ * @param tail - set to the last node of the merged chain
+ * @return head of the merged chain
+ */
+template<class Node, class Less, class Links>
+Node merge_chains(Node a, Node aTail, Node b, Node bTail, Node &tail, Less &less, Links &links){
+	if(!less(links.data(b), links.data(aTail))) {
+		links.next(aTail) = b;
+		tail = bTail;
+		return a;
+	}
+	if(less(links.data(bTail), links.data(a))) {
+		links.next(bTail) = a;
+		tail = aTail;
+		return b;
+	}
+
+	Node head;
+	Node *joinPoint = &head;
+	for(;;) {
+		// take from chain b only if it's strictly less, that keeps sort stable
+		if(less(links.data(b), links.data(a))) {
+			*joinPoint = b;
+			joinPoint = &links.next(b);
+			b = links.next(b);
+			if(!b) {
+				*joinPoint = a;
+				tail = aTail;
+				return head;
+			}
+		}
+		else {
+			*joinPoint = a;
+			joinPoint = &links.next(a);
+			a = links.next(a);
+			if(!a) {
+				*joinPoint = b;
+				tail = bTail;
+				return head;
+			}
+		}
+	}
+}
+
+/**
+ * @brief sort a null-terminated chain of nodes
+ * bottom-up merge sort, nodes are taken one by one and merged into bins
+ * where bin i keeps a sorted chain of 2^i nodes, like std::list::sort does.
+ * Merged chains are never re-walked, sort is stable, i.e. equal elements keep their order
+ * @param root - head of the chain, updated to the new head on return
+ * @param less - predicate, returns true if it's first argument goes before the second one
+ * @param links - node access policy, see ChainLinks
+ * @return last node of the sorted chain
+ */
+template<class Node, class Less, class Links = ChainLinks<Node> >
+Node sort_chain(Node &root, Less &&less, Links links = Links()){
+	// enough bins to sort any number of nodes an unsigned size could hold
+	Node head[sizeof(unsigned) * 8], tail[sizeof(unsigned) * 8];
+	unsigned fill = 0;
+
+	Node p = root;
+	while(p) {
+		Node carry = p, carryTail = p;
+		p = links.next(p);
+		links.next(carry) = Node();
+
+		// bins hold older nodes, so they go first in merge
+		unsigned i = 0;
+		for(; i != fill && head[i]; ++i) {
+			carry = merge_chains(head[i], tail[i], carry, carryTail, carryTail, less, links);
+			head[i] = Node();
+		}
+		if(i == fill)
+			++fill;
+
+		head[i] = carry;
+		tail[i] = carryTail;
+	}
+
+	// higher bins hold older nodes
+	Node result = Node(), resultTail = Node();
+	for(unsigned i = 0; i != fill; ++i) {
+		if(!head[i])
+			continue;
+
+		if(result)
+			result = merge_chains(head[i], tail[i], result, resultTail, resultTail, less, links);
+		else {
+			result = head[i];
+			resultTail = tail[i];
+		}
+	}
+
+	root = result;
+	return resultTail;
+}
+
+/**
+ * @brief list access counters, available with LINKEDLIST_STATS defined
+ */
+struct ListStats {
+	unsigned long getNode = 0;		// node lookups by index
+	unsigned long cacheHits = 0;	// lookups served by root/last or walking from the cached node
+	unsigned long cacheMisses = 0;	// lookups walking from the root node
+	unsigned long traversed = 0;	// nodes walked by lookups
+	unsigned long popScans = 0;		// pop() walks to find the node before the last one
+	unsigned long allocs = 0;
+	unsigned long allocFails = 0;
+	unsigned long frees = 0;
+	unsigned long compares = 0;		// sort comparisons
+	unsigned peakSize = 0;
+
+	void resized(unsigned size){ if (size > peakSize) peakSize = size; }
+
+#ifdef LINKEDLIST_STATS
+	/**
+	 * @brief print counters as a single line of "name=value" pairs
+	 * @return snprintf() result, number of chars the full line takes
+	 */
+	int dump(char *buf, size_t len) const {
+		return snprintf(buf, len, "getNode=%lu hits=%lu misses=%lu traversed=%lu popScans=%lu allocs=%lu allocFails=%lu frees=%lu compares=%lu peakSize=%u",
+			getNode, cacheHits, cacheMisses, traversed, popScans, allocs, allocFails, frees, compares, peakSize);
+	}
+#endif
+};
+
+// 'less' predicate counting it's calls
+template<class Less>
+struct CountingLess {
+	Less &less;
+	unsigned long &count;
+
+	template<class A, class B>
+	bool operator()(A &x, B &y) const { ++count; return less(x, y); }
+};
+
+}	// namespace llist
+
+/**
+ * @brief what a list with limited capacity does with an object added when it's full
+ */
+enum class ListOverflow : unsigned char {
+	reject,			// object is not added, add() returns false
+	drop_oldest,	// the first object is dropped to make room, it's node is reused
+	drop_newest		// new object is dropped, add() returns false and it's counted in dropped()
 };
 
-template <typename T>
-class LinkedList{
+/**
+ * @brief LinkedList implementation without virtual methods
+ * calls are resolved at compile time and could be inlined, objects have no vtable pointer.
+ * Use it directly on hot paths, LinkedList is a virtual compatibility layer holding it as a member.
+ * The class is final, it has no virtual destructor and it's methods do not dispatch to overrides
+ */
+template <typename T, class Alloc = NodeHeapAllocator< ListNode<T> > >
+class LinkedListCore final {
+
+	// lists built on the core reach it's nodes directly
+	template<typename, class> friend class LinkedList;
+	template<typename, class> friend class ConcurrentLinkedList;
+	template<typename, class, class, class> friend class HashedLinkedList;
 
 protected:
+	Alloc _alloc;
 	unsigned _size = 0;
 	ListNode<T> *root = nullptr;
 	ListNode<T>	*last = nullptr;
@@ -36,9 +554,62 @@ protected:
 	mutable ListNode<T> *lastNodeGot = nullptr;
 	mutable unsigned lastIndexGot=0;		// cached node index
 
+#ifdef LINKEDLIST_STATS
+	mutable llist::ListStats _stats;
+#endif
+
+	// max number of objects, 0 - unlimited
+	unsigned _capacity = 0;
+	// max size the list ever had
+	unsigned _highWater = 0;
+	// objects dropped by overflow policy
+	unsigned _dropped = 0;
+	ListOverflow _overflow = ListOverflow::reject;
+
 	ListNode<T>* getNode(unsigned index) const;
 
-	ListNode<T>* findEndOfSortedString(ListNode<T> *p, int (*cmp)(T &, T &));
+	// update high water mark after size grew
+	void _grown(){
+		if (_size > _highWater)
+			_highWater = _size;
+		LINKEDLIST_STAT(_stats.resized(_size));
+	}
+
+	// take nodes for n more objects at once if allocator is able to, see NodeSlabAllocator
+	template<class A = Alloc>
+	auto _reserveNodes(unsigned n, int) -> decltype(std::declval<A&>().reserve(n), void()){ _alloc.reserve(n); }
+	void _reserveNodes(unsigned, long){}
+
+	// true if capacity is limited and the list is full
+	bool _full() const { return _capacity && _size >= _capacity; }
+
+	/**
+	 * @brief apply overflow policy before adding one object to the full list
+	 * drop_oldest deletes the first node, others count the drop
+	 * @return false if the object must not be added
+	 */
+	bool _overflowed();
+
+	/**
+	 * @brief drop_oldest for the full list: construct new object in the first node and move it to the end
+	 */
+	template<class... Args>
+	bool _recycleRoot(Args&&... args);
+
+	/**
+	 * @brief take new node from allocator and construct it's data in-place from args
+	 * @return pointer to the new node or nullptr if allocator is out of memory
+	 */
+	template<class... Args>
+	ListNode<T>* _newNode(ListNode<T>* _next, Args&&... args);
+
+	/**
+	 * @brief destruct node and return it back to allocator
+	 */
+	void _freeNode(ListNode<T>* node);
+
+	// free all nodes of a detached null-terminated chain
+	void _freeChain(ListNode<T>* head);
 
 	/**
 	 * @brief delete last node in a list
@@ -52,44 +623,122 @@ protected:
 	 */
 	void _shift();
 
+	/**
+	 * @brief link a new node constructed from args after prev node
+	 * node cache is updated to point to the new node if prev's index is known
+	 * @param prevIndex - index of prev node or -1 if unknown
+	 * @return new node or nullptr if allocator has no free nodes
+	 */
+	template<class... Args>
+	ListNode<T>* _emplaceAfter(ListNode<T> *prev, unsigned prevIndex, Args&&... args);
+
+	/**
+	 * @brief link new node constructed from args after prev, or to the start if prev is nullptr
+	 * capacity is not checked, objects moved from lists with other allocator instances
+	 * are not limited the same way as relinked nodes. Node cache is reset
+	 * @return new node or nullptr if allocator has no free nodes
+	 */
+	template<class... Args>
+	ListNode<T>* _linkNew(ListNode<T> *prev, Args&&... args);
+
+	/**
+	 * @brief unlink and delete the node next to prev
+	 * @param prevIndex - index of prev node or -1 if unknown
+	 * @return false if there is no node after prev
+	 */
+	bool _eraseAfter(ListNode<T> *prev, unsigned prevIndex);
+
+	/**
+	 * @brief link a null-terminated chain of count nodes before index (index <= size)
+	 * node cache is set to the tail of the chain
+	 */
+	void _linkChain(unsigned index, ListNode<T> *head, ListNode<T> *tail, unsigned count);
+
+	/**
+	 * @brief sort nodes with a 'less' predicate and reset node cache
+	 */
+	template<class Less>
+	void _sort(Less &&less);
+
+	/**
+	 * @brief find the first node for which before(obj) is false, list must be partitioned by before()
+	 * walk starts from the cached node if it's before the point, so sequential ordered inserts are cheap.
+	 * Node cache is moved to prev
+	 * @param prev - set to the node preceding the point or nullptr if it's at the start
+	 * @return index of the point, size if before() is true for all objects
+	 */
+	template<class Before>
+	unsigned _partitionPoint(Before &&before, ListNode<T>* &prev) const;
+
+	template<class Less, class... Args>
+	bool _insertSorted(const T& key, Less &&less, Args&&... args);
+
+	template<class Less>
+	bool _merge(LinkedListCore &other, Less &&less);
+
 public:
-	LinkedList(){};
-	LinkedList(unsigned sizeIndex, T _t); //initiate list size and default value
-	LinkedList(const LinkedList<T> &rhs) : LinkedList(){ *this = rhs; };	// clone constructor
-	virtual ~LinkedList();
+	LinkedListCore(){};
+	LinkedListCore(unsigned sizeIndex, T _t); //initiate list size and default value
+	LinkedListCore(const LinkedListCore &rhs) : LinkedListCore(){ *this = rhs; };	// clone constructor
+	LinkedListCore(LinkedListCore &&rhs) : LinkedListCore(){ *this = std::move(rhs); };	// move constructor
+	~LinkedListCore();
 
 	/*
 		Returns current size of LinkedList
 	*/
-	virtual unsigned size() const;
+	unsigned size() const;
 	/*
 		Adds a T object in the specified index;
 		Unlink and link the LinkedList correcly;
 		Increment _size
+		Returns false if allocator has no free nodes
 	*/
-	virtual bool add(unsigned index, const T&);
+	bool add(unsigned index, const T&);
+	bool add(unsigned index, T&&);
 	/*
 		Adds a T object in the end of the LinkedList;
 		Increment _size;
 	*/
-	virtual bool add(const T&);
+	bool add(const T&);
+	bool add(T&&);
 	/*
 		Adds a T object in the start of the LinkedList;
 		Increment _size;
 	*/
-	virtual bool unshift(const T&);
+	bool unshift(const T&);
+	bool unshift(T&&);
 	/*
 		Set the object at index, with T;
 	*/
-	virtual bool set(unsigned index, const T&);
+	bool set(unsigned index, const T&);
+	bool set(unsigned index, T&&);
+
+	/**
+	 * @brief construct T object in-place from args at the specified index
+	 * same as add(index, T(args...)) but without temporary object
+	 */
+	template<class... Args>
+	bool emplace(unsigned index, Args&&... args);
+
+	/**
+	 * @brief construct T object in-place from args in the end of the list
+	 */
+	template<class... Args>
+	bool emplace_back(Args&&... args);
+
+	/**
+	 * @brief construct T object in-place from args in the start of the list
+	 */
+	template<class... Args>
+	bool emplace_front(Args&&... args);
 
 	/*
 		Remove node at index;
 		If index is not reachable, returns false;
 		else, deletes node
-		Returns a copy of T object from removed node
+		Returns T object moved out of removed node
 	*/
-	virtual T remove(unsigned index);
+	T remove(unsigned index);
 
 	/*
 		Unlink and delete node at index;
@@ -101,22 +750,22 @@ public:
 
 	/*
 		Remove last object;
-		Returns a copy of T object from removed node
+		Returns T object moved out of removed node
 	*/
-	virtual T pop();
+	T pop();
 
 	/**
 	 * @brief 		Remove first object
-	 *	Returns a copy of T object from removed node
+	 *	Returns T object moved out of removed node
 	 */
-	virtual T shift();
+	T shift();
 
 	/*
 		Get the index'th element on the list;
 		Return Element if accessible,
 		else, return false;
 	*/
-	virtual T get(unsigned index) const;
+	T get(unsigned index) const;
 
 
 	/*
@@ -124,14 +773,14 @@ public:
 		Return Element if accessible,
 		else, return T();
 	*/
-	virtual T front() const;
+	T front() const;
 
 	/*
 		Get last element of the list;
 		Return Element if accessible,
 		else, return T();
 	*/
-	virtual T back() const;
+	T back() const;
 
 	// same as front()
 	T head() const { return front(); }
@@ -139,11 +788,59 @@ public:
 	// same as back()
 	T tail() const { return back(); }
 
+	/**
+	 * @brief references to the first/last object, no copies made
+	 * NOTE: list must not be empty, check size() first
+	 */
+	T& front_ref(){ return root->data; };
+	const T& front_ref() const { return root->data; };
+	T& back_ref(){ return last->data; };
+	const T& back_ref() const { return last->data; };
+
+	/**
+	 * @brief copy the index'th object to out
+	 * @return false if index is not reachable, out is not touched then
+	 */
+	bool try_get(unsigned index, T& out) const;
+
+	/**
+	 * @brief move the last/first object to out and delete it's node
+	 * unlike pop()/shift() no dummy object is constructed for empty list
+	 * @return false if list is empty, out is not touched then
+	 */
+	bool try_pop(T& out);
+	bool try_shift(T& out);
+
+	/**
+	 * @brief find the first object equal to value
+	 * @return pointer to the object in the list or nullptr if not found
+	 */
+	T* find(const T& value){ return const_cast<T*>(static_cast<const LinkedListCore*>(this)->find(value)); };
+	const T* find(const T& value) const;
+
+	/**
+	 * @brief find the first object matching pred(const T&)
+	 * @return pointer to the object in the list or nullptr if not found
+	 */
+	template<class Pred>
+	T* find_if(Pred pred){ return const_cast<T*>(static_cast<const LinkedListCore*>(this)->find_if(pred)); };
+	template<class Pred>
+	const T* find_if(Pred pred) const;
+
+	// true if there is an object equal to value
+	bool contains(const T& value) const { return find(value) != nullptr; };
+
+	/**
+	 * @brief index of the first object equal to value
+	 * @return -1 if not found
+	 */
+	int index_of(const T& value) const;
+
 	/*
 		Return true if element with specified index exist
 		note: this works faster than (uncached) get(index)
 	*/
-	virtual bool exist(unsigned index) const;
+	bool exist(unsigned index) const;
 
 	/**
 	 * @brief clear linked list
@@ -153,19 +850,175 @@ public:
 	 * if node contains pointers to dynamically allocated objects created
 	 * with 'new' operator it will result in a mem leak!
 	 */
-	virtual void clear();
+	void clear();
 
 	/*
 		Sort the list, given a comparison function
 	*/
-	virtual void sort(int (*cmp)(T &, T &));
+	void sort(int (*cmp)(T &, T &));
+
+	/**
+	 * @brief sort the list with any callable: function, functor or lambda
+	 * comparator is inlined, so it is faster than sorting via a function pointer.
+	 * Sort is stable, i.e. equal elements keep their relative order
+	 * @param cmp - 'less' predicate returning bool, i.e. std::less<>, or
+	 * strcmp-like comparator returning int <0, 0, >0
+	 */
+	template<class Compare = std::less<> >
+	void sort(Compare &&cmp = Compare());
+
+	/**
+	 * @brief move all nodes of other list before index (to the end if index >= size)
+	 * nodes are relinked without allocations or copies, other list becomes empty.
+	 * Lists with allocators which are not always equal (i.e. NodePool) move objects one by one
+	 * @return false if allocator has no free nodes, objects moved so far stay in this list
+	 */
+	bool splice(unsigned index, LinkedListCore &other){ return splice_range(index, other, 0, other._size); };
+	bool splice(unsigned index, LinkedListCore &&other){ return splice_range(index, other, 0, other._size); };
+
+	/**
+	 * @brief move count nodes of other list starting from first before index (to the end if index >= size)
+	 * count is clipped to the end of other list, this list can't be spliced to itself
+	 * @return false if other is this list or if allocator has no free nodes
+	 */
+	bool splice_range(unsigned index, LinkedListCore &other, unsigned first, unsigned count);
+
+	/**
+	 * @brief move all nodes of other list to the end of this one, O(1)
+	 */
+	bool append(LinkedListCore &&other){ return splice_range(_size, other, 0, other._size); };
+
+	/**
+	 * @brief cut the list at index
+	 * @return list with elements starting from index, this list keeps elements [0, index)
+	 */
+	LinkedListCore split_at(unsigned index);
+
+	/**
+	 * @brief add copies of objects from [first, last) to the end of the list
+	 * nodes are allocated and constructed first, then linked to the list at once
+	 * @return false if allocator has no free nodes, list is left unchanged then
+	 */
+	template<class InputIt>
+	bool add_range(InputIt first, InputIt last){ return insert_range(_size, first, last); };
+
+	/**
+	 * @brief insert copies of objects from [first, last) before index (to the end if index >= size)
+	 * Overflow policy is applied per object, same as for add(index) of each object in turn:
+	 * drop_oldest drops the first object of the list (it could be one of the range) for every
+	 * object over capacity, reject and drop_newest insert objects which fit and skip the rest.
+	 * Bounded list never holds more than capacity() nodes meanwhile
+	 * @return false if some objects were rejected or dropped by drop_newest,
+	 * or allocator has no free nodes, list is left unchanged then
+	 * (except for objects dropped by drop_oldest to make room)
+	 */
+	template<class InputIt>
+	bool insert_range(unsigned index, InputIt first, InputIt last);
+
+	/**
+	 * @brief limit number of objects in the list
+	 * checked by methods adding one object: add(), unshift(), emplace*(), insert_sorted(), insert_range().
+	 * Iterator and cursor insert_after() just fail on the full list. Nodes and objects moved from other lists
+	 * by splice(), merge() and move assignment are not limited.
+	 * Longer list is trimmed, dropping the first objects for drop_oldest, the last ones otherwise
+	 * @param capacity - max number of objects, 0 - unlimited
+	 * @param policy - what to do with objects added to the full list
+	 */
+	void setCapacity(unsigned capacity, ListOverflow policy = ListOverflow::reject);
+
+	// max number of objects, 0 - unlimited
+	unsigned capacity() const { return _capacity; };
+
+	// node allocator of this list
+	Alloc& allocator(){ return _alloc; }
+
+	/**
+	 * @brief make sure there are nodes for n objects, so adding them makes no heap calls
+	 * available with allocators keeping released nodes, i.e. NodeCacheAllocator or NodeSlabAllocator
+	 * @return false if there is no memory, or n is over NodeCacheAllocator::setLimit()
+	 */
+	template<class A = Alloc>
+	auto reserve(unsigned n) -> decltype(std::declval<A&>().reserve(n)){ return _alloc.reserve(n > _size ? n - _size : 0); }
+
+	// return nodes kept by the allocator to the heap
+	template<class A = Alloc>
+	auto shrink_to_fit() -> decltype(std::declval<A&>().shrink_to_fit()){ return _alloc.shrink_to_fit(); }
+
+	// max size the list ever had since creation or resetHighWaterMark()
+	unsigned highWaterMark() const { return _highWater; };
+	void resetHighWaterMark(){ _highWater = _size; };
+
+	// number of objects dropped by drop_oldest/drop_newest policies
+	unsigned dropped() const { return _dropped; };
+
+	/**
+	 * @brief delete all elements matching pred(const T&) in one pass
+	 * @return number of deleted elements
+	 */
+	template<class Pred>
+	unsigned remove_if(Pred pred);
+
+	/**
+	 * @brief delete elements with indexes [from, to)
+	 * @return number of deleted elements
+	 */
+	unsigned erase_range(unsigned from, unsigned to);
+
+	/**
+	 * @brief delete consecutive duplicates, keeps the first element of each group
+	 * @param eq - equality predicate, operator== by default
+	 * @return number of deleted elements
+	 */
+	template<class BinaryPred = std::equal_to<> >
+	unsigned unique(BinaryPred eq = BinaryPred());
+
+	/**
+	 * @brief insert object keeping the list sorted, after all objects equal to it
+	 * Adding in order is O(1), otherwise the list is walked from the cached node or from the start.
+	 * List must be sorted with the same comparator
+	 * @param cmp - 'less' predicate or strcmp-like comparator, same as for sort(Compare&&)
+	 * @return false if allocator has no free nodes
+	 */
+	template<class Compare = std::less<> >
+	bool insert_sorted(const T& _t, Compare &&cmp = Compare()){ return _insertSorted(_t, llist::make_less<T>(cmp), _t); };
+	template<class Compare = std::less<> >
+	bool insert_sorted(T&& _t, Compare &&cmp = Compare()){ return _insertSorted(_t, llist::make_less<T>(cmp), std::move(_t)); };
+
+	/**
+	 * @brief merge sorted other list into this sorted list in one pass, other list becomes empty
+	 * nodes are relinked without allocations, objects of this list go first if equal.
+	 * Lists with allocators which are not always equal (i.e. NodePool) move objects one by one
+	 * @return false if allocator has no free nodes, objects moved so far stay in this list
+	 */
+	template<class Compare = std::less<> >
+	bool merge(LinkedListCore &other, Compare &&cmp = Compare()){ return _merge(other, llist::make_less<T>(cmp)); };
+	template<class Compare = std::less<> >
+	bool merge(LinkedListCore &&other, Compare &&cmp = Compare()){ return _merge(other, llist::make_less<T>(cmp)); };
+
+	/**
+	 * @brief index of the first object not less than / greater than value in a sorted list
+	 * @return size() if there is no such object
+	 */
+	template<class Compare = std::less<> >
+	unsigned lower_bound(const T& value, Compare &&cmp = Compare()) const;
+	template<class Compare = std::less<> >
+	unsigned upper_bound(const T& value, Compare &&cmp = Compare()) const;
 
 
 	inline T& operator[](unsigned i) { return getNode(i)->data; }
 	inline const T& operator[](const unsigned i) const { return getNode(i)->data; }
 
-	// deep-copy via assign operator
-	virtual LinkedList<T> & operator =(const LinkedList<T> &rhs);
+	// deep-copy via assign operator, nodes are reserved in one go if allocator supports it
+	LinkedListCore & operator =(const LinkedListCore &rhs);
+
+	/**
+	 * @brief move assignment
+	 * takes over nodes chain of rhs in O(1) leaving rhs empty.
+	 * If nodes could not be released by other allocator instance (i.e. NodePool)
+	 * then objects are moved one by one into the nodes of this list,
+	 * objects left when allocator has no free nodes stay in rhs
+	 */
+	LinkedListCore & operator =(LinkedListCore &&rhs);
 
 	/*
 		ConstIterator class
@@ -194,7 +1047,7 @@ public:
 		//friend bool operator== (const ConstIterator& a, const ConstIterator& b) { return a.m_ptr == b.m_ptr; };
 		//friend bool operator!= (const ConstIterator& a, const ConstIterator& b) { return a.m_ptr != b.m_ptr; };
 
-		friend LinkedList<T>;
+		friend LinkedListCore;
 
 		protected:
 			ListNode<T> *m_ptr;
@@ -213,37 +1066,129 @@ public:
 		using reference         = T&;
 
 		Iterator(ListNode<T> *ptr = nullptr) : ConstIterator(ptr) {}
+		Iterator(ListNode<T> *ptr, LinkedListCore *list) : ConstIterator(ptr), m_list(list) {}
 		Iterator(){}
 
 		reference operator*() { return this->m_ptr->data; }
 		pointer operator->() { return &this->m_ptr->data; }
+
+		/**
+		 * @brief construct new object from args right after iterator's position
+		 * iteration continues with the new element
+		 * @return false for end() iterator or if allocator has no free nodes
+		 */
+		template<class... Args>
+		bool emplace_after(Args&&... args);
+		bool insert_after(const T& _t){ return emplace_after(_t); };
+		bool insert_after(T&& _t){ return emplace_after(std::move(_t)); };
+
+		/**
+		 * @brief delete the element next to iterator's position
+		 * @return false if there is no next element
+		 */
+		bool erase_after();
+
+		protected:
+			LinkedListCore *m_list = nullptr;
+	};
+
+	/*
+		Cursor class
+		caller-owned position in the list,
+		access, insertion and removal relative to cursor's position is O(1)
+		and does not depend on list's internal node cache.
+		Cursor stays valid until it's node is removed from the list.
+		Cursor's index is not adjusted if list is changed before it's position not via this cursor,
+		so edits via cursor drop list's node cache instead of setting it from cursor's index
+	*/
+	class Cursor {
+		LinkedListCore *_list;
+		ListNode<T> *_node;
+		unsigned _index;
+
+	public:
+		Cursor(LinkedListCore &list, unsigned index = 0) : _list(&list), _node(list.getNode(index)), _index(index) {}
+
+		// cursor points to an existing element
+		bool valid() const { return _node != nullptr; }
+
+		// index of cursor's element
+		unsigned index() const { return _index; }
+
+		// element at cursor's position, cursor must be valid
+		T& get() const { return _node->data; }
+		T& operator*() const { return _node->data; }
+		T* operator->() const { return &_node->data; }
+
+		/**
+		 * @brief move cursor n elements forward
+		 * @return false if moved beyond the last element, cursor becomes invalid
+		 */
+		bool advance(unsigned n = 1);
+
+		/**
+		 * @brief move cursor to index, walks forward from cursor's position if possible
+		 * @return false if index is not reachable
+		 */
+		bool seek(unsigned index);
+
+		/**
+		 * @brief construct new object from args right after cursor's position
+		 * @return false if cursor is not valid or allocator has no free nodes
+		 */
+		template<class... Args>
+		bool emplace_after(Args&&... args){ return _node && _list->_emplaceAfter(_node, -1, std::forward<Args>(args)...); };
+		bool insert_after(const T& _t){ return emplace_after(_t); };
+		bool insert_after(T&& _t){ return emplace_after(std::move(_t)); };
+
+		/**
+		 * @brief delete the element next to cursor's position
+		 * @return false if there is no next element
+		 */
+		bool erase_after(){ return _node && _list->_eraseAfter(_node, -1); };
 	};
 
+	// cursor pointing to element at index
+	Cursor cursor(unsigned index = 0) { return Cursor(*this, index); }
+
+#ifdef LINKEDLIST_STATS
+	/**
+	 * @brief access counters of this list, see llist::ListStats
+	 * high traversed/getNode ratio or cache misses point to random access by index,
+	 * popScans count O(n) pop() calls
+	 */
+	const llist::ListStats& stats() const { return _stats; }
+	void resetStats(){ _stats = llist::ListStats(); _stats.resized(_size); }
+
+	// print counters to buf, returns snprintf() result
+	int dumpStats(char *buf, size_t len) const { return _stats.dump(buf, len); }
+#endif
+
 	// iterator methods
 	ConstIterator cbegin() const { return ConstIterator(root); }
 	ConstIterator cend() const { return ConstIterator(nullptr); }   // same as last->next for non-empty list
-	Iterator begin() { return Iterator(root); }
-	Iterator end() { return Iterator(nullptr); }                    // same as last->next for non-empty list
+	Iterator begin() { return Iterator(root, this); }
+	Iterator end() { return Iterator(nullptr, this); }              // same as last->next for non-empty list
 
 };
 
 // D-tor
-template<typename T>
-LinkedList<T>::~LinkedList(){ clear(); }
+template<typename T, class Alloc>
+LinkedListCore<T, Alloc>::~LinkedListCore(){ clear(); }
 
 /*
 	Actualy "logic" coding
 */
-template<typename T>
-ListNode<T>* LinkedList<T>::getNode(unsigned index) const {
+template<typename T, class Alloc>
+ListNode<T>* LinkedListCore<T, Alloc>::getNode(unsigned index) const {
 	if (!_size || index >=_size)
 		return nullptr;
 
-	if (!index)
-		return root;
-
-	if (index == _size-1)
-		return last;
+	LINKEDLIST_STAT(++_stats.getNode);
+	if (!index || index == _size-1){
+		LINKEDLIST_STAT(++_stats.cacheHits);
+		return index ? last : root;
+	}
 
 	unsigned _pos = 0;
 	ListNode<T>* current = root;
@@ -253,8 +1198,11 @@ ListNode<T>* LinkedList<T>::getNode(unsigned index) const {
 	if(lastIndexGot <= index){
 		_pos = lastIndexGot;
 		current = lastNodeGot;
-	}
+		LINKEDLIST_STAT(++_stats.cacheHits);
+	} else
+		LINKEDLIST_STAT(++_stats.cacheMisses);
 
+	LINKEDLIST_STAT(_stats.traversed += index - _pos);
 	while(_pos < index && current){
 		current = current->next;
 		_pos++;
@@ -270,66 +1218,160 @@ ListNode<T>* LinkedList<T>::getNode(unsigned index) const {
 	return nullptr;
 }
 
-template<typename T>
-unsigned LinkedList<T>::size() const {
+template<typename T, class Alloc>
+template<class... Args>
+ListNode<T>* LinkedListCore<T, Alloc>::_newNode(ListNode<T>* _next, Args&&... args){
+	ListNode<T> *node = _alloc.allocate();
+	LINKEDLIST_STAT(node ? ++_stats.allocs : ++_stats.allocFails);
+	return node ? new (node) ListNode<T>(ListNodeEmplace(), _next, std::forward<Args>(args)...) : nullptr;
+}
+
+template<typename T, class Alloc>
+void LinkedListCore<T, Alloc>::_freeNode(ListNode<T>* node){
+	node->~ListNode();
+	_alloc.deallocate(node);
+	LINKEDLIST_STAT(++_stats.frees);
+}
+
+template<typename T, class Alloc>
+void LinkedListCore<T, Alloc>::_freeChain(ListNode<T>* head){
+	while (head){
+		ListNode<T> *_next = head->next;
+		_freeNode(head);
+		head = _next;
+	}
+}
+
+template<typename T, class Alloc>
+unsigned LinkedListCore<T, Alloc>::size() const {
 	return _size;
 }
 
-template<typename T>
-LinkedList<T>::LinkedList(unsigned sizeIndex, T _t){
+template<typename T, class Alloc>
+LinkedListCore<T, Alloc>::LinkedListCore(unsigned sizeIndex, T _t){
+	_reserveNodes(sizeIndex, 0);
 	for (unsigned i = 0; i < sizeIndex; i++){
 		add(_t);
 	}
 }
 
-template<typename T>
-bool LinkedList<T>::add(unsigned index, const T& _t){
+template<typename T, class Alloc>
+bool LinkedListCore<T, Alloc>::add(unsigned index, const T& _t){
+	return emplace(index, _t);
+}
+
+template<typename T, class Alloc>
+bool LinkedListCore<T, Alloc>::add(unsigned index, T&& _t){
+	return emplace(index, std::move(_t));
+}
+
+template<typename T, class Alloc>
+template<class... Args>
+bool LinkedListCore<T, Alloc>::emplace(unsigned index, Args&&... args){
 	if(index >= _size)
-		return add(_t);
+		return emplace_back(std::forward<Args>(args)...);
 
 	if(!index)
-		return unshift(_t);
+		return emplace_front(std::forward<Args>(args)...);
 
-	lastIndexGot = index;
-	ListNode<T> *_prev = getNode(--index);
+	if (_full()){
+		if (_overflow != ListOverflow::drop_oldest)
+			return _overflowed();
 
-	_prev->next = new ListNode<T>(_t, _prev->next);
-	lastNodeGot = _prev->next;
+		// args could refer to the object about to be dropped
+		T obj(std::forward<Args>(args)...);
+		_overflowed();
+		// first node is gone, so is the index of the new object
+		return emplace(index - 1, std::move(obj));
+	}
+
+	ListNode<T> *_prev = getNode(index - 1);
+
+	ListNode<T> *node = _newNode(_prev->next, std::forward<Args>(args)...);
+	if (!node)
+		return false;
+
+	_prev->next = node;
+	lastNodeGot = node;
+	lastIndexGot = index;
 
 	_size++;
+	_grown();
 
 	return true;
 }
 
-template<typename T>
-bool LinkedList<T>::add(const T& _t){
-	
+template<typename T, class Alloc>
+bool LinkedListCore<T, Alloc>::add(const T& _t){
+	return emplace_back(_t);
+}
+
+template<typename T, class Alloc>
+bool LinkedListCore<T, Alloc>::add(T&& _t){
+	return emplace_back(std::move(_t));
+}
+
+template<typename T, class Alloc>
+template<class... Args>
+bool LinkedListCore<T, Alloc>::emplace_back(Args&&... args){
+	if (_full())
+		return _overflow == ListOverflow::drop_oldest ? _recycleRoot(std::forward<Args>(args)...) : _overflowed();
+
+	ListNode<T> *node = _newNode(nullptr, std::forward<Args>(args)...);
+	if (!node)
+		return false;
+
 	if(root){
 		// Already have elements inserted
-		last->next = new ListNode<T>(_t);
-		last = last->next;
+		last->next = node;
+		last = node;
 	} else {
 		// First element being inserted
-		root = new ListNode<T>(_t);
-		last = root;
+		root = last = node;
 	}
 
 	lastIndexGot = _size;
 	lastNodeGot = last;
 	++_size;
+	_grown();
 
 	return true;
 }
 
-template<typename T>
-bool LinkedList<T>::unshift(const T& _t){
+template<typename T, class Alloc>
+bool LinkedListCore<T, Alloc>::unshift(const T& _t){
+	return emplace_front(_t);
+}
+
+template<typename T, class Alloc>
+bool LinkedListCore<T, Alloc>::unshift(T&& _t){
+	return emplace_front(std::move(_t));
+}
+
+template<typename T, class Alloc>
+template<class... Args>
+bool LinkedListCore<T, Alloc>::emplace_front(Args&&... args){
 
 	if(!_size)
-		return add(_t);
+		return emplace_back(std::forward<Args>(args)...);
 
-	root = new ListNode<T>(_t, root);
-	
+	if (_full()){
+		if (_overflow != ListOverflow::drop_oldest)
+			return _overflowed();
+
+		// new first object replaces the oldest one in it's node
+		root->data = T(std::forward<Args>(args)...);
+		++_dropped;
+		return true;
+	}
+
+	ListNode<T> *node = _newNode(root, std::forward<Args>(args)...);
+	if (!node)
+		return false;
+
+	root = node;
 	_size++;
+	_grown();
 
 	lastIndexGot = 0;
 	lastNodeGot = root;
@@ -337,8 +1379,8 @@ bool LinkedList<T>::unshift(const T& _t){
 	return true;
 }
 
-template<typename T>
-bool LinkedList<T>::set(unsigned index, const T& _t){
+template<typename T, class Alloc>
+bool LinkedListCore<T, Alloc>::set(unsigned index, const T& _t){
 	// Check if index position is in bounds
 	if(index >= _size)
 		return false;
@@ -347,52 +1389,63 @@ bool LinkedList<T>::set(unsigned index, const T& _t){
 	return true;
 }
 
-template<typename T>
-void LinkedList<T>::_pop(){
+template<typename T, class Alloc>
+bool LinkedListCore<T, Alloc>::set(unsigned index, T&& _t){
+	// Check if index position is in bounds
+	if(index >= _size)
+		return false;
+
+	getNode(index)->data = std::move(_t);
+	return true;
+}
+
+template<typename T, class Alloc>
+void LinkedListCore<T, Alloc>::_pop(){
 	if(!_size)
 		return;
 
 	if (_size == 1){
 		// Only one element left on the list
-		delete(root);
+		_freeNode(root);
 		root = last = lastNodeGot = nullptr;
 		lastIndexGot = _size = 0;
 		return;
 	}
 
+	LINKEDLIST_STAT(++_stats.popScans);
 	ListNode<T> *tmp = getNode(_size - 2);
-	delete(tmp->next);
+	_freeNode(tmp->next);
 	tmp->next = nullptr;
 	last = lastNodeGot = tmp;
 	lastIndexGot = --_size;
 	--lastIndexGot;
 }
 
-template<typename T>
-T LinkedList<T>::pop(){
+template<typename T, class Alloc>
+T LinkedListCore<T, Alloc>::pop(){
 	if(!_size)
 		return T();
 
 	if(_size > 1){
 		ListNode<T> *tmp = getNode(_size - 2);
-		T ret(tmp->next->data);
+		T ret(std::move(tmp->next->data));
 		_pop();
 		return ret;
 	}
 
-	T ret(root->data);
+	T ret(std::move(root->data));
 	_pop();
 	return ret;
 }
 
-template<typename T>
-void LinkedList<T>::_shift(){
+template<typename T, class Alloc>
+void LinkedListCore<T, Alloc>::_shift(){
 	if(!_size)
 		return;
 
 	if (_size == 1){
 		// Only one element left on the list
-		delete(root);
+		_freeNode(root);
 		root = last = lastNodeGot = nullptr;
 		lastIndexGot = _size = 0;
 		return;
@@ -400,24 +1453,24 @@ void LinkedList<T>::_shift(){
 
 	// drop first node
 	ListNode<T> *_next = root->next;
-	delete(root);
+	_freeNode(root);
 	root = lastNodeGot = _next;
 	lastIndexGot = 0;
 	--_size;	
 }
 
-template<typename T>
-T LinkedList<T>::shift(){
+template<typename T, class Alloc>
+T LinkedListCore<T, Alloc>::shift(){
 	if(!_size)
 		return T();
 
-	T data(root->data);
+	T data(std::move(root->data));
 	_shift();
 	return data;
 }
 
-template<typename T>
-T LinkedList<T>::remove(unsigned index){
+template<typename T, class Alloc>
+T LinkedListCore<T, Alloc>::remove(unsigned index){
 	if (index >= _size)
 		return T();
 
@@ -427,13 +1480,13 @@ T LinkedList<T>::remove(unsigned index){
 	if (index == _size-1)
 		return pop();
 
-	T ret(getNode(index)->data);
+	T ret(std::move(getNode(index)->data));
 	unlink(index);
 	return ret;
 }
 
-template<typename T>
-void LinkedList<T>::unlink(unsigned index){
+template<typename T, class Alloc>
+void LinkedListCore<T, Alloc>::unlink(unsigned index){
 	if (!_size || index >= _size)
 		return;
 
@@ -446,114 +1499,641 @@ void LinkedList<T>::unlink(unsigned index){
 	ListNode<T> *prev = getNode(--index);
 	ListNode<T> *toDelete = prev->next;
 	prev->next = prev->next->next;
-	delete(toDelete);
+	_freeNode(toDelete);
 	_size--;
 	lastIndexGot = index;
 	lastNodeGot = prev;
 }
 
-template<typename T>
-T LinkedList<T>::get(unsigned index) const {
+template<typename T, class Alloc>
+template<class... Args>
+ListNode<T>* LinkedListCore<T, Alloc>::_emplaceAfter(ListNode<T> *prev, unsigned prevIndex, Args&&... args){
+	// nodes could not be dropped under iterators and cursors
+	if (_full())
+		return nullptr;
+
+	ListNode<T> *node = _newNode(prev->next, std::forward<Args>(args)...);
+	if (!node)
+		return nullptr;
+
+	prev->next = node;
+	if (last == prev)
+		last = node;
+	++_size;
+	_grown();
+
+	if (prevIndex != static_cast<unsigned>(-1)){
+		lastNodeGot = node;
+		lastIndexGot = prevIndex + 1;
+	} else {
+		// indexes after prev are shifted, drop the cache
+		lastNodeGot = root;
+		lastIndexGot = 0;
+	}
+
+	return node;
+}
+
+template<typename T, class Alloc>
+template<class... Args>
+ListNode<T>* LinkedListCore<T, Alloc>::_linkNew(ListNode<T> *prev, Args&&... args){
+	ListNode<T> *node = _newNode(prev ? prev->next : root, std::forward<Args>(args)...);
+	if (!node)
+		return nullptr;
+
+	if (prev)
+		prev->next = node;
+	else
+		root = node;
+	if (last == prev)
+		last = node;
+	++_size;
+	_grown();
+
+	lastNodeGot = root;
+	lastIndexGot = 0;
+	return node;
+}
+
+template<typename T, class Alloc>
+bool LinkedListCore<T, Alloc>::_eraseAfter(ListNode<T> *prev, unsigned prevIndex){
+	ListNode<T> *node = prev->next;
+	if (!node)
+		return false;
+
+	prev->next = node->next;
+	if (last == node)
+		last = prev;
+	_freeNode(node);
+	--_size;
+
+	if (prevIndex != static_cast<unsigned>(-1)){
+		lastNodeGot = prev;
+		lastIndexGot = prevIndex;
+	} else {
+		lastNodeGot = root;
+		lastIndexGot = 0;
+	}
+
+	return true;
+}
+
+template<typename T, class Alloc>
+template<class... Args>
+bool LinkedListCore<T, Alloc>::Iterator::emplace_after(Args&&... args){
+	if (!this->m_ptr || !m_list)
+		return false;
+
+	ListNode<T> *node = m_list->_emplaceAfter(this->m_ptr, -1, std::forward<Args>(args)...);
+	if (!node)
+		return false;
+
+	this->m_next_ptr = node;
+	return true;
+}
+
+template<typename T, class Alloc>
+bool LinkedListCore<T, Alloc>::Iterator::erase_after(){
+	if (!this->m_ptr || !m_list || !m_list->_eraseAfter(this->m_ptr, -1))
+		return false;
+
+	this->m_next_ptr = this->m_ptr->next;
+	return true;
+}
+
+template<typename T, class Alloc>
+bool LinkedListCore<T, Alloc>::Cursor::advance(unsigned n){
+	while (n-- && _node){
+		_node = _node->next;
+		++_index;
+	}
+
+	return _node != nullptr;
+}
+
+template<typename T, class Alloc>
+bool LinkedListCore<T, Alloc>::Cursor::seek(unsigned index){
+	if (index >= _list->_size){
+		_node = nullptr;
+		return false;
+	}
+
+	if (_node && _index <= index)
+		return advance(index - _index);
+
+	_node = _list->getNode(index);
+	_index = index;
+	return true;
+}
+
+template<typename T, class Alloc>
+T LinkedListCore<T, Alloc>::get(unsigned index) const {
 	ListNode<T> *tmp = getNode(index);
 
 	return (tmp ? tmp->data : T());
 }
 
-template<typename T>
-void LinkedList<T>::clear(){
+template<typename T, class Alloc>
+bool LinkedListCore<T, Alloc>::try_get(unsigned index, T& out) const {
+	ListNode<T> *node = getNode(index);
+	if (!node)
+		return false;
+
+	out = node->data;
+	return true;
+}
+
+template<typename T, class Alloc>
+bool LinkedListCore<T, Alloc>::try_pop(T& out){
+	if (!_size)
+		return false;
+
+	out = std::move(last->data);
+	_pop();
+	return true;
+}
+
+template<typename T, class Alloc>
+bool LinkedListCore<T, Alloc>::try_shift(T& out){
+	if (!_size)
+		return false;
+
+	out = std::move(root->data);
+	_shift();
+	return true;
+}
+
+template<typename T, class Alloc>
+const T* LinkedListCore<T, Alloc>::find(const T& value) const {
+	for (const ListNode<T> *node = root; node; node = node->next){
+		if (node->data == value)
+			return &node->data;
+	}
+
+	return nullptr;
+}
+
+template<typename T, class Alloc>
+template<class Pred>
+const T* LinkedListCore<T, Alloc>::find_if(Pred pred) const {
+	for (const ListNode<T> *node = root; node; node = node->next){
+		if (pred(static_cast<const T&>(node->data)))
+			return &node->data;
+	}
+
+	return nullptr;
+}
+
+template<typename T, class Alloc>
+int LinkedListCore<T, Alloc>::index_of(const T& value) const {
+	int index = 0;
+	for (const ListNode<T> *node = root; node; node = node->next, ++index){
+		if (node->data == value)
+			return index;
+	}
+
+	return -1;
+}
+
+template<typename T, class Alloc>
+void LinkedListCore<T, Alloc>::clear(){
 	while(_size)
 		_shift();
 }
 
-template<typename T>
-void LinkedList<T>::sort(int (*cmp)(T &, T &)){
+template<typename T, class Alloc>
+void LinkedListCore<T, Alloc>::sort(int (*cmp)(T &, T &)){
+	_sort(llist::make_less<T>(cmp));
+}
+
+template<typename T, class Alloc>
+template<class Compare>
+void LinkedListCore<T, Alloc>::sort(Compare &&cmp){
+	_sort(llist::make_less<T>(cmp));
+}
+
+template<typename T, class Alloc>
+template<class Less>
+void LinkedListCore<T, Alloc>::_sort(Less &&less){
 	if(_size < 2) return; // trivial case;
 
-	for(;;) {	
+#ifdef LINKEDLIST_STATS
+	last = llist::sort_chain(root, llist::CountingLess<typename std::remove_reference<Less>::type>{less, _stats.compares});
+#else
+	last = llist::sort_chain(root, less);
+#endif
+	lastNodeGot = root;
+	lastIndexGot = 0;
+}
 
-		ListNode<T> **joinPoint = &root;
+template<typename T, class Alloc>
+template<class Before>
+unsigned LinkedListCore<T, Alloc>::_partitionPoint(Before &&before, ListNode<T>* &prev) const {
+	prev = nullptr;
+	if (!_size || !before(root->data))
+		return 0;
+
+	// appending in order
+	prev = last;
+	if (before(last->data))
+		return _size;
+
+	// last object is not before the point, so the walk stops before the end
+	unsigned index = 1;
+	prev = root;
+	if (lastIndexGot && lastNodeGot && before(lastNodeGot->data)){
+		prev = lastNodeGot;
+		index = lastIndexGot + 1;
+	}
 
-		while(*joinPoint) {
-			ListNode<T> *a = *joinPoint;
-			ListNode<T> *a_end = findEndOfSortedString(a, cmp);
-	
-			if(!a_end->next	) {
-				if(joinPoint == &root) {
-					last = a_end;
-					lastNodeGot = root;
-					lastIndexGot = 0;
-					return;
-				}
-				else {
-					break;
-				}
-			}
+	while (before(prev->next->data)){
+		prev = prev->next;
+		++index;
+	}
 
-			ListNode<T> *b = a_end->next;
-			ListNode<T> *b_end = findEndOfSortedString(b, cmp);
-
-			ListNode<T> *tail = b_end->next;
-
-			a_end->next = NULL;
-			b_end->next = NULL;
-
-			while(a && b) {
-				if(cmp(a->data, b->data) <= 0) {
-					*joinPoint = a;
-					joinPoint = &a->next;
-					a = a->next;	
-				}
-				else {
-					*joinPoint = b;
-					joinPoint = &b->next;
-					b = b->next;	
-				}
-			}
+	lastNodeGot = prev;
+	lastIndexGot = index - 1;
+	return index;
+}
 
-			if(a) {
-				*joinPoint = a;
-				while(a->next) a = a->next;
-				a->next = tail;
-				joinPoint = &a->next;
-			}
-			else {
-				*joinPoint = b;
-				while(b->next) b = b->next;
-				b->next = tail;
-				joinPoint = &b->next;
+template<typename T, class Alloc>
+template<class Less, class... Args>
+bool LinkedListCore<T, Alloc>::_insertSorted(const T& key, Less &&less, Args&&... args){
+	if (_full()){
+		if (_overflow != ListOverflow::drop_oldest)
+			return _overflowed();
+
+		// key could be the object about to be dropped
+		T obj(std::forward<Args>(args)...);
+		_overflowed();
+		return _insertSorted(obj, less, std::move(obj));
+	}
+
+	// comparators like sort(int (*)(T&, T&)) take non-const references, they must not change objects
+	T &k = const_cast<T&>(key);
+	ListNode<T> *prev;
+	unsigned index = _partitionPoint([&](T& obj){ return !less(k, obj); }, prev);
+
+	if (!prev)
+		return emplace_front(std::forward<Args>(args)...);
+
+	return _emplaceAfter(prev, index - 1, std::forward<Args>(args)...) != nullptr;
+}
+
+template<typename T, class Alloc>
+template<class Compare>
+unsigned LinkedListCore<T, Alloc>::lower_bound(const T& value, Compare &&cmp) const {
+	auto less = llist::make_less<T>(cmp);
+	T &v = const_cast<T&>(value);
+	ListNode<T> *prev;
+	return _partitionPoint([&](T& obj){ return less(obj, v); }, prev);
+}
+
+template<typename T, class Alloc>
+template<class Compare>
+unsigned LinkedListCore<T, Alloc>::upper_bound(const T& value, Compare &&cmp) const {
+	auto less = llist::make_less<T>(cmp);
+	T &v = const_cast<T&>(value);
+	ListNode<T> *prev;
+	return _partitionPoint([&](T& obj){ return !less(v, obj); }, prev);
+}
+
+template<typename T, class Alloc>
+template<class Less>
+bool LinkedListCore<T, Alloc>::_merge(LinkedListCore &other, Less &&less){
+	if (&other == this || !other._size)
+		return true;
+
+	if (!Alloc::is_always_equal){
+		// nodes must stay with other's allocator, move objects one by one
+		ListNode<T> *prev = nullptr;
+		while (other._size){
+			ListNode<T> *next = prev ? prev->next : root;
+			while (next && !less(other.root->data, next->data)){
+				prev = next;
+				next = next->next;
 			}
+
+			ListNode<T> *node = _linkNew(prev, std::move(other.root->data));
+			if (!node)
+				return false;
+
+			other._shift();
+			prev = node;
 		}
+		return true;
+	}
+
+	if (!_size){
+		*this = std::move(other);
+		return true;
 	}
+
+	llist::ChainLinks<ListNode<T>*> links;
+	root = llist::merge_chains(root, last, other.root, other.last, last, less, links);
+	_size += other._size;
+	_grown();
+	lastNodeGot = root;
+	lastIndexGot = 0;
+
+	other.root = other.last = other.lastNodeGot = nullptr;
+	other._size = other.lastIndexGot = 0;
+	return true;
 }
 
-template<typename T>
-ListNode<T>* LinkedList<T>::findEndOfSortedString(ListNode<T> *p, int (*cmp)(T &, T &)) {
-	while(p->next && cmp(p->data, p->next->data) <= 0) {
-		p = p->next;
+template<typename T, class Alloc>
+bool LinkedListCore<T, Alloc>::_overflowed(){
+	switch (_overflow){
+	case ListOverflow::drop_oldest:
+		_shift();
+		++_dropped;
+		return true;
+	case ListOverflow::drop_newest:
+		++_dropped;
+		return false;
+	default:
+		return false;
 	}
-	
-	return p;
 }
 
-template<typename T>
-T LinkedList<T>::front() const {
+template<typename T, class Alloc>
+template<class... Args>
+bool LinkedListCore<T, Alloc>::_recycleRoot(Args&&... args){
+	// args could refer to an object in the list, so new object is built before the old one is gone
+	ListNode<T> *node = root;
+	node->data = T(std::forward<Args>(args)...);
+	++_dropped;
+
+	if (node == last)
+		return true;
+
+	root = node->next;
+	node->next = nullptr;
+	last->next = node;
+	last = node;
+
+	lastNodeGot = root;
+	lastIndexGot = 0;
+	return true;
+}
+
+template<typename T, class Alloc>
+void LinkedListCore<T, Alloc>::setCapacity(unsigned capacity, ListOverflow policy){
+	_capacity = capacity;
+	_overflow = policy;
+
+	if (!_capacity || _size <= _capacity)
+		return;
+
+	if (policy == ListOverflow::drop_oldest){
+		while (_size > _capacity)
+			_shift();
+	} else
+		erase_range(_capacity, _size);
+}
+
+template<typename T, class Alloc>
+T LinkedListCore<T, Alloc>::front() const {
 	return _size ? root->data : T();
 }
 
-template<typename T>
-T LinkedList<T>::back() const {
+template<typename T, class Alloc>
+T LinkedListCore<T, Alloc>::back() const {
 	return _size ? last->data : T();
 }
 
-template<typename T>
-bool LinkedList<T>::exist(unsigned index) const {
+template<typename T, class Alloc>
+bool LinkedListCore<T, Alloc>::exist(unsigned index) const {
 	return (index < _size);
 }
 
-template<typename T>
-LinkedList<T>& LinkedList<T>::operator =(const LinkedList<T>& rhs) {
+template<typename T, class Alloc>
+bool LinkedListCore<T, Alloc>::splice_range(unsigned index, LinkedListCore &other, unsigned first, unsigned count){
+	if (&other == this)
+		return false;
+
+	if (first >= other._size || !count)
+		return true;
+
+	if (count > other._size - first)
+		count = other._size - first;
+
+	if (index > _size)
+		index = _size;
+
+	if (!Alloc::is_always_equal){
+		// nodes must stay with other's allocator, move objects one by one
+		ListNode<T> *src = first ? other.getNode(first - 1) : nullptr;
+		ListNode<T> *prev = index ? getNode(index - 1) : nullptr;
+		for (unsigned i = 0; i != count; ++i){
+			prev = _linkNew(prev, std::move(src ? src->next->data : other.root->data));
+			if (!prev)
+				return false;
+
+			if (src)
+				other._eraseAfter(src, first - 1);
+			else
+				other._shift();
+		}
+		return true;
+	}
+
+	// cut [first, first + count) out of other list
+	ListNode<T> *otherPrev = first ? other.getNode(first - 1) : nullptr;
+	ListNode<T> *head = otherPrev ? otherPrev->next : other.root;
+	ListNode<T> *tail = first + count == other._size ? other.last : other.getNode(first + count - 1);
+
+	if (otherPrev)
+		otherPrev->next = tail->next;
+	else
+		other.root = tail->next;
+
+	if (other.last == tail)
+		other.last = otherPrev;
+
+	other._size -= count;
+	other.lastNodeGot = otherPrev ? otherPrev : other.root;
+	other.lastIndexGot = otherPrev ? first - 1 : 0;
+
+	_linkChain(index, head, tail, count);
+	return true;
+}
+
+template<typename T, class Alloc>
+void LinkedListCore<T, Alloc>::_linkChain(unsigned index, ListNode<T> *head, ListNode<T> *tail, unsigned count){
+	ListNode<T> *prev = index ? getNode(index - 1) : nullptr;
+	if (prev){
+		tail->next = prev->next;
+		prev->next = head;
+	} else {
+		tail->next = root;
+		root = head;
+	}
+
+	if (index == _size)
+		last = tail;
+
+	_size += count;
+	_grown();
+	lastNodeGot = tail;
+	lastIndexGot = index + count - 1;
+}
+
+template<typename T, class Alloc>
+LinkedListCore<T, Alloc> LinkedListCore<T, Alloc>::split_at(unsigned index){
+	LinkedListCore rest;
+	if (index < _size)
+		rest.splice_range(0, *this, index, _size - index);
+
+	return rest;
+}
+
+template<typename T, class Alloc>
+template<class InputIt>
+bool LinkedListCore<T, Alloc>::insert_range(unsigned index, InputIt first, InputIt last){
+	if (index > _size)
+		index = _size;
+
+	// build a detached chain first, so the list is untouched if allocator fails
+	ListNode<T> *head = nullptr;
+	ListNode<T> *tail = nullptr;
+	unsigned count = 0;
+	bool fits = true;
+	for (; first != last; ++first){
+		if (_capacity && _size + count >= _capacity){
+			if (_overflow != ListOverflow::drop_oldest){
+				// objects that fit are inserted, the rest of the range is not allocated
+				if (_overflow == ListOverflow::drop_newest)
+					_dropped += static_cast<unsigned>(std::distance(first, last));
+				fits = false;
+				break;
+			}
+
+			// make room for the next object dropping the first one of the list as it would be
+			// with the chain linked: objects before index, then the chain, then objects after it
+			++_dropped;
+			if (index || !head){
+				_shift();
+				if (index)
+					--index;
+			} else {
+				ListNode<T> *_next = head->next;
+				_freeNode(head);
+				head = _next;
+				if (!head)
+					tail = nullptr;
+				--count;
+			}
+		}
+
+		ListNode<T> *node = _newNode(nullptr, *first);
+		if (!node){
+			_freeChain(head);
+			return false;
+		}
+
+		if (tail)
+			tail->next = node;
+		else
+			head = node;
+		tail = node;
+		++count;
+	}
+
+	if (head)
+		_linkChain(index, head, tail, count);
+	return fits;
+}
+
+template<typename T, class Alloc>
+template<class Pred>
+unsigned LinkedListCore<T, Alloc>::remove_if(Pred pred){
+	unsigned removed = 0;
+	ListNode<T> *prev = nullptr;
+	ListNode<T> *node = root;
+
+	while (node){
+		ListNode<T> *_next = node->next;
+		if (pred(static_cast<const T&>(node->data))){
+			if (prev)
+				prev->next = _next;
+			else
+				root = _next;
+			_freeNode(node);
+			++removed;
+		} else
+			prev = node;
+		node = _next;
+	}
+
+	last = prev;
+	_size -= removed;
+	lastNodeGot = root;
+	lastIndexGot = 0;
+	return removed;
+}
+
+template<typename T, class Alloc>
+unsigned LinkedListCore<T, Alloc>::erase_range(unsigned from, unsigned to){
+	if (to > _size)
+		to = _size;
+	if (from >= to)
+		return 0;
+
+	ListNode<T> *prev = from ? getNode(from - 1) : nullptr;
+	ListNode<T> *node = prev ? prev->next : root;
+	for (unsigned i = from; i != to; ++i){
+		ListNode<T> *_next = node->next;
+		_freeNode(node);
+		node = _next;
+	}
+
+	if (prev)
+		prev->next = node;
+	else
+		root = node;
+
+	if (!node)
+		last = prev;
+
+	_size -= to - from;
+	lastNodeGot = prev ? prev : root;
+	lastIndexGot = prev ? from - 1 : 0;
+	return to - from;
+}
+
+template<typename T, class Alloc>
+template<class BinaryPred>
+unsigned LinkedListCore<T, Alloc>::unique(BinaryPred eq){
+	if (_size < 2)
+		return 0;
+
+	unsigned removed = 0;
+	ListNode<T> *prev = root;
+	while (ListNode<T> *node = prev->next){
+		if (eq(static_cast<const T&>(prev->data), static_cast<const T&>(node->data))){
+			prev->next = node->next;
+			_freeNode(node);
+			++removed;
+		} else
+			prev = node;
+	}
+
+	last = prev;
+	_size -= removed;
+	lastNodeGot = root;
+	lastIndexGot = 0;
+	return removed;
+}
+
+template<typename T, class Alloc>
+LinkedListCore<T, Alloc>& LinkedListCore<T, Alloc>::operator =(const LinkedListCore& rhs) {
+	if (this == &rhs)
+		return *this;
+
     clear();
-	LinkedList::ConstIterator i(rhs.root);
+	_reserveNodes(rhs._size, 0);
+	LinkedListCore::ConstIterator i(rhs.root);
 	while (i != rhs.cend()){
 		add(*i);
 		++i;
@@ -564,3 +2144,239 @@ LinkedList<T>& LinkedList<T>::operator =(const LinkedList<T>& rhs) {
 
     return *this;
 }
+
+template<typename T, class Alloc>
+LinkedListCore<T, Alloc>& LinkedListCore<T, Alloc>::operator =(LinkedListCore&& rhs) {
+	if (this == &rhs)
+		return *this;
+
+	clear();
+
+	if (!Alloc::is_always_equal){
+		// nodes must stay with rhs's allocator, move objects one by one,
+		// ones which could not be moved for lack of nodes stay in rhs
+		while (rhs._size){
+			if (!_linkNew(last, std::move(rhs.root->data)))
+				break;
+			rhs._shift();
+		}
+		return *this;
+	}
+
+	root = rhs.root;
+	last = rhs.last;
+	_size = rhs._size;
+	_grown();
+	lastNodeGot = rhs.lastNodeGot;
+	lastIndexGot = rhs.lastIndexGot;
+
+	rhs.root = rhs.last = rhs.lastNodeGot = nullptr;
+	rhs._size = rhs.lastIndexGot = 0;
+
+	return *this;
+}
+
+/**
+ * @brief LinkedList with virtual methods
+ * keeps API of the original library for derived classes overriding it's methods.
+ * The list itself is a non-virtual LinkedListCore member, virtual methods call each other
+ * the way original ones did, i.e. remove() takes the ends via shift()/pop()
+ * and assignment goes via clear() and add(), so overrides of those methods are honored
+ */
+template <typename T, class Alloc = NodeHeapAllocator< ListNode<T> > >
+class LinkedList {
+	using core_t = LinkedListCore<T, Alloc>;
+
+protected:
+	core_t _core;
+
+public:
+	using ConstIterator = typename core_t::ConstIterator;
+	using Iterator = typename core_t::Iterator;
+	using Cursor = typename core_t::Cursor;
+
+	LinkedList(){};
+	LinkedList(unsigned sizeIndex, T _t) : _core(sizeIndex, _t) {};
+	LinkedList(const LinkedList &rhs) : _core(rhs._core) {};
+	LinkedList(LinkedList &&rhs) : _core(std::move(rhs._core)) {};
+	// takes over a list returned by core methods, i.e. split_at()
+	explicit LinkedList(core_t &&rhs) : _core(std::move(rhs)) {};
+	virtual ~LinkedList(){};
+
+	virtual unsigned size() const { return _core.size(); };
+	virtual bool add(unsigned index, const T& _t){ return _core.add(index, _t); };
+	virtual bool add(unsigned index, T&& _t){ return _core.add(index, std::move(_t)); };
+	virtual bool add(const T& _t){ return _core.add(_t); };
+	virtual bool add(T&& _t){ return _core.add(std::move(_t)); };
+	virtual bool unshift(const T& _t){ return _core.unshift(_t); };
+	virtual bool unshift(T&& _t){ return _core.unshift(std::move(_t)); };
+	virtual bool set(unsigned index, const T& _t){ return _core.set(index, _t); };
+	virtual bool set(unsigned index, T&& _t){ return _core.set(index, std::move(_t)); };
+	// first and last objects are taken by shift() and pop()
+	virtual T remove(unsigned index);
+	virtual T pop(){ return _core.pop(); };
+	virtual T shift(){ return _core.shift(); };
+	virtual T get(unsigned index) const { return _core.get(index); };
+	virtual T front() const { return _core.front(); };
+	virtual T back() const { return _core.back(); };
+	virtual bool exist(unsigned index) const { return _core.exist(index); };
+	virtual void clear(){ _core.clear(); };
+	virtual void sort(int (*cmp)(T &, T &)){ _core.sort(cmp); };
+
+	// rhs objects are added one by one via add() after clear()
+	virtual LinkedList & operator =(const LinkedList &rhs);
+	// clear() is called before nodes of rhs are taken over
+	virtual LinkedList & operator =(LinkedList &&rhs);
+
+	T head() const { return front(); }
+	T tail() const { return back(); }
+
+	/*
+		Non-virtual methods, see LinkedListCore
+	*/
+	template<class... Args>
+	bool emplace(unsigned index, Args&&... args){ return _core.emplace(index, std::forward<Args>(args)...); };
+	template<class... Args>
+	bool emplace_back(Args&&... args){ return _core.emplace_back(std::forward<Args>(args)...); };
+	template<class... Args>
+	bool emplace_front(Args&&... args){ return _core.emplace_front(std::forward<Args>(args)...); };
+
+	void unlink(unsigned index){ _core.unlink(index); };
+
+	T& front_ref(){ return _core.front_ref(); };
+	const T& front_ref() const { return _core.front_ref(); };
+	T& back_ref(){ return _core.back_ref(); };
+	const T& back_ref() const { return _core.back_ref(); };
+
+	bool try_get(unsigned index, T& out) const { return _core.try_get(index, out); };
+	bool try_pop(T& out){ return _core.try_pop(out); };
+	bool try_shift(T& out){ return _core.try_shift(out); };
+
+	T* find(const T& value){ return _core.find(value); };
+	const T* find(const T& value) const { return _core.find(value); };
+	template<class Pred>
+	T* find_if(Pred pred){ return _core.find_if(pred); };
+	template<class Pred>
+	const T* find_if(Pred pred) const { return _core.find_if(pred); };
+	bool contains(const T& value) const { return _core.contains(value); };
+	int index_of(const T& value) const { return _core.index_of(value); };
+
+	template<class Compare = std::less<> >
+	void sort(Compare &&cmp = Compare()){ _core.sort(std::forward<Compare>(cmp)); };
+
+	bool splice(unsigned index, LinkedList &other){ return _core.splice(index, other._core); };
+	bool splice(unsigned index, LinkedList &&other){ return _core.splice(index, other._core); };
+	bool splice(unsigned index, core_t &other){ return _core.splice(index, other); };
+	bool splice(unsigned index, core_t &&other){ return _core.splice(index, other); };
+	bool splice_range(unsigned index, LinkedList &other, unsigned first, unsigned count){ return _core.splice_range(index, other._core, first, count); };
+	bool splice_range(unsigned index, core_t &other, unsigned first, unsigned count){ return _core.splice_range(index, other, first, count); };
+	bool append(LinkedList &&other){ return _core.append(std::move(other._core)); };
+	bool append(core_t &&other){ return _core.append(std::move(other)); };
+	LinkedList split_at(unsigned index){ return LinkedList(_core.split_at(index)); };
+
+	template<class InputIt>
+	bool add_range(InputIt first, InputIt last){ return _core.add_range(first, last); };
+	template<class InputIt>
+	bool insert_range(unsigned index, InputIt first, InputIt last){ return _core.insert_range(index, first, last); };
+
+	void setCapacity(unsigned capacity, ListOverflow policy = ListOverflow::reject){ _core.setCapacity(capacity, policy); };
+	unsigned capacity() const { return _core.capacity(); };
+	unsigned highWaterMark() const { return _core.highWaterMark(); };
+	void resetHighWaterMark(){ _core.resetHighWaterMark(); };
+	unsigned dropped() const { return _core.dropped(); };
+
+	Alloc& allocator(){ return _core.allocator(); }
+	template<class A = Alloc>
+	auto reserve(unsigned n) -> decltype(std::declval<A&>().reserve(n)){ return _core.reserve(n); }
+	template<class A = Alloc>
+	auto shrink_to_fit() -> decltype(std::declval<A&>().shrink_to_fit()){ return _core.shrink_to_fit(); }
+
+	template<class Pred>
+	unsigned remove_if(Pred pred){ return _core.remove_if(pred); };
+	unsigned erase_range(unsigned from, unsigned to){ return _core.erase_range(from, to); };
+	template<class BinaryPred = std::equal_to<> >
+	unsigned unique(BinaryPred eq = BinaryPred()){ return _core.unique(eq); };
+
+	template<class Compare = std::less<> >
+	bool insert_sorted(const T& _t, Compare &&cmp = Compare()){ return _core.insert_sorted(_t, std::forward<Compare>(cmp)); };
+	template<class Compare = std::less<> >
+	bool insert_sorted(T&& _t, Compare &&cmp = Compare()){ return _core.insert_sorted(std::move(_t), std::forward<Compare>(cmp)); };
+	template<class Compare = std::less<> >
+	bool merge(LinkedList &other, Compare &&cmp = Compare()){ return _core.merge(other._core, std::forward<Compare>(cmp)); };
+	template<class Compare = std::less<> >
+	bool merge(LinkedList &&other, Compare &&cmp = Compare()){ return _core.merge(other._core, std::forward<Compare>(cmp)); };
+	template<class Compare = std::less<> >
+	bool merge(core_t &other, Compare &&cmp = Compare()){ return _core.merge(other, std::forward<Compare>(cmp)); };
+	template<class Compare = std::less<> >
+	unsigned lower_bound(const T& value, Compare &&cmp = Compare()) const { return _core.lower_bound(value, std::forward<Compare>(cmp)); };
+	template<class Compare = std::less<> >
+	unsigned upper_bound(const T& value, Compare &&cmp = Compare()) const { return _core.upper_bound(value, std::forward<Compare>(cmp)); };
+
+	inline T& operator[](unsigned i) { return _core[i]; }
+	inline const T& operator[](const unsigned i) const { return _core[i]; }
+
+	Cursor cursor(unsigned index = 0) { return _core.cursor(index); }
+
+#ifdef LINKEDLIST_STATS
+	const llist::ListStats& stats() const { return _core.stats(); }
+	void resetStats(){ _core.resetStats(); }
+	int dumpStats(char *buf, size_t len) const { return _core.dumpStats(buf, len); }
+#endif
+
+	// iterator methods
+	ConstIterator cbegin() const { return _core.cbegin(); }
+	ConstIterator cend() const { return _core.cend(); }
+	Iterator begin() { return _core.begin(); }
+	Iterator end() { return _core.end(); }
+};
+
+template<typename T, class Alloc>
+T LinkedList<T, Alloc>::remove(unsigned index){
+	if (index >= _core._size)
+		return T();
+
+	if (!index)
+		return shift();
+
+	if (index == _core._size - 1)
+		return pop();
+
+	T ret(std::move(_core.getNode(index)->data));
+	_core.unlink(index);
+	return ret;
+}
+
+template<typename T, class Alloc>
+LinkedList<T, Alloc>& LinkedList<T, Alloc>::operator =(const LinkedList& rhs){
+	if (this == &rhs)
+		return *this;
+
+	clear();
+	_core._reserveNodes(rhs._core._size, 0);
+	for (ConstIterator i = rhs.cbegin(); i != rhs.cend(); ++i)
+		add(*i);
+
+	return *this;
+}
+
+template<typename T, class Alloc>
+LinkedList<T, Alloc>& LinkedList<T, Alloc>::operator =(LinkedList&& rhs){
+	if (this == &rhs)
+		return *this;
+
+	clear();
+	_core = std::move(rhs._core);
+	return *this;
+}
+
+// LinkedList with nodes taken from inline fixed-capacity pool of N nodes
+template<typename T, size_t N>
+using PooledLinkedList = LinkedList<T, NodePool<ListNode<T>, N> >;
+
+// LinkedList keeping released nodes for reuse, see NodeCacheAllocator
+template<typename T>
+using CachedLinkedList = LinkedList<T, NodeCacheAllocator< ListNode<T> > >;
+
+// LinkedList taking nodes from contiguous slabs, see NodeSlabAllocator
+template<typename T>
+using SlabLinkedList = LinkedList<T, NodeSlabAllocator< ListNode<T> > >;
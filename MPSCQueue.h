@@ -0,0 +1,222 @@
+/*
+	MPSCQueue.h - Lock-free multi-producer / single-consumer queue built on ListNode
+	Based on Dmitry Vyukov's non-intrusive MPSC node-based queue
+
+	Any number of threads/tasks could add() objects concurrently,
+	only one thread at a time is allowed to shift() them out.
+	add() is wait-free except for node allocation, shift() is lock-free.
+
+	Allocator is shared by all producers and the consumer, so it must be safe to call concurrently.
+	Default one takes nodes from the heap, do not add() from ISR with it
+	unless your platform's allocator is ISR-safe. AtomicNodePool is a lock-free
+	fixed pool, with it add() makes no heap calls and could be called from ISR
+
+	For instructions, go to https://github.com/vortigont/LinkedList
+*/
+
+#pragma once
+
+#include "LinkedList.h"
+#include <atomic>
+#include <stdint.h>
+
+/**
+ * @brief lock-free fixed-capacity node pool
+ * storage for N nodes is inline like in NodePool, free slots are chained by 16-bit indexes
+ * in a separate array, chain head is an atomic word with an ABA tag.
+ * allocate() and deallocate() never block, so they are safe from any number of threads and from ISR
+ * provided that 32-bit atomics are lock-free on the platform
+ */
+template<class Node, size_t N>
+class AtomicNodePool {
+	static_assert(N > 0 && N < 0xFFFF, "pool is indexed by 16-bit slot numbers");
+
+	static constexpr uint16_t none = 0xFFFF;
+
+	struct Slot {
+		alignas(Node) unsigned char node[sizeof(Node)];
+	};
+
+	Slot _slots[N];
+	std::atomic<uint16_t> _next[N];
+	// free chain head: slot index in low 16 bits, counter of changes in high ones against ABA
+	std::atomic<uint32_t> _free;
+
+	static uint32_t _head(uint32_t old, uint16_t index){ return ((old + 0x10000) & 0xFFFF0000) | index; }
+
+public:
+	// nodes could be released only to the pool they were taken from
+	static constexpr bool is_always_equal = false;
+
+	AtomicNodePool(){
+		for (size_t i = 0; i != N; ++i)
+			_next[i].store(i + 1 < N ? static_cast<uint16_t>(i + 1) : none, std::memory_order_relaxed);
+		_free.store(0, std::memory_order_release);
+	}
+	AtomicNodePool(const AtomicNodePool&) = delete;
+	AtomicNodePool& operator=(const AtomicNodePool&) = delete;
+
+	Node* allocate(){
+		uint32_t head = _free.load(std::memory_order_acquire);
+		for (;;){
+			uint16_t i = head & 0xFFFF;
+			if (i == none)
+				return nullptr;
+
+			if (_free.compare_exchange_weak(head, _head(head, _next[i].load(std::memory_order_relaxed)),
+					std::memory_order_acquire, std::memory_order_acquire))
+				return reinterpret_cast<Node*>(_slots[i].node);
+		}
+	}
+
+	void deallocate(Node *n){
+		uint16_t i = static_cast<uint16_t>(reinterpret_cast<Slot*>(n) - _slots);
+		uint32_t head = _free.load(std::memory_order_relaxed);
+		do {
+			_next[i].store(head & 0xFFFF, std::memory_order_relaxed);
+		} while (!_free.compare_exchange_weak(head, _head(head, i), std::memory_order_release, std::memory_order_relaxed));
+	}
+
+	// total number of nodes in a pool
+	size_t capacity() const { return N; }
+};
+
+/**
+ * @brief lock-free multi-producer / single-consumer queue
+ * @tparam Alloc - node allocator safe for concurrent calls, i.e. AtomicNodePool for ISR producers
+ */
+template <typename T, class Alloc = NodeHeapAllocator< ListNode<T> > >
+class MPSCQueue{
+
+protected:
+	Alloc _alloc;
+	// producers side, the most recently added node
+	std::atomic<ListNode<T>*> _head;
+	// consumer side, stub node which next one holds the oldest object.
+	// stub's object is destroyed already, so T needs no default constructor
+	ListNode<T> *_tail;
+
+	// ListNode::next is accessed atomically via compiler builtins, it is shared between producers and consumer
+	static ListNode<T>* _loadNext(ListNode<T> *node){ return __atomic_load_n(&node->next, __ATOMIC_ACQUIRE); }
+	static void _storeNext(ListNode<T> *node, ListNode<T> *next){ __atomic_store_n(&node->next, next, __ATOMIC_RELEASE); }
+
+	// link new node to the producers end of a queue
+	void _push(ListNode<T> *node);
+
+	// destroy the oldest object, it's node becomes a new stub
+	bool _drop();
+
+public:
+	// queue stays empty and add() returns false if there is no node for the stub
+	MPSCQueue();
+	MPSCQueue(const MPSCQueue&) = delete;
+	MPSCQueue& operator=(const MPSCQueue&) = delete;
+	~MPSCQueue();
+
+	/*
+		Adds a T object in the end of the queue;
+		Safe to call from any number of threads;
+		Returns false if there is no memory for a new node
+	*/
+	bool add(const T& _t){ return emplace_back(_t); };
+	bool add(T&& _t){ return emplace_back(std::move(_t)); };
+
+	/**
+	 * @brief construct T object in-place from args in the end of the queue
+	 * Safe to call from any number of threads
+	 */
+	template<class... Args>
+	bool emplace_back(Args&&... args);
+
+	/**
+	 * @brief move the oldest object out of the queue
+	 * must be called from a single consumer thread only
+	 * @param out - destination for the object
+	 * @return false if the queue is empty (or producer is in the middle of linking a node)
+	 */
+	bool shift(T& out);
+
+	/**
+	 * @brief check if there is nothing to shift
+	 * should be called from the consumer thread
+	 */
+	bool empty() const { return !_tail || !_loadNext(_tail); };
+
+	/**
+	 * @brief delete all objects in the queue
+	 * must be called from the consumer thread
+	 */
+	void clear();
+};
+
+
+template<typename T, class Alloc>
+MPSCQueue<T, Alloc>::MPSCQueue(){
+	// stub carries only a link, it's object is never constructed
+	_tail = _alloc.allocate();
+	if (_tail)
+		_tail->next = nullptr;
+	_head.store(_tail, std::memory_order_relaxed);
+}
+
+template<typename T, class Alloc>
+MPSCQueue<T, Alloc>::~MPSCQueue(){
+	if (!_tail)
+		return;
+
+	clear();
+	_alloc.deallocate(_tail);
+}
+
+template<typename T, class Alloc>
+void MPSCQueue<T, Alloc>::_push(ListNode<T> *node){
+	// serialization point for producers
+	ListNode<T> *prev = _head.exchange(node, std::memory_order_acq_rel);
+	// until this store node is invisible to the consumer
+	_storeNext(prev, node);
+}
+
+template<typename T, class Alloc>
+template<class... Args>
+bool MPSCQueue<T, Alloc>::emplace_back(Args&&... args){
+	// head is null only if there was no node for the stub
+	if (!_head.load(std::memory_order_relaxed))
+		return false;
+
+	ListNode<T> *node = _alloc.allocate();
+	if (!node)
+		return false;
+
+	new (node) ListNode<T>(ListNodeEmplace(), nullptr, std::forward<Args>(args)...);
+	_push(node);
+	return true;
+}
+
+template<typename T, class Alloc>
+bool MPSCQueue<T, Alloc>::_drop(){
+	ListNode<T> *tail = _tail;
+	ListNode<T> *next = tail ? _loadNext(tail) : nullptr;
+	if (!next)
+		return false;
+
+	// next becomes a new stub
+	next->data.~T();
+	_tail = next;
+	_alloc.deallocate(tail);
+	return true;
+}
+
+template<typename T, class Alloc>
+bool MPSCQueue<T, Alloc>::shift(T& out){
+	ListNode<T> *next = _tail ? _loadNext(_tail) : nullptr;
+	if (!next)
+		return false;
+
+	out = std::move(next->data);
+	return _drop();
+}
+
+template<typename T, class Alloc>
+void MPSCQueue<T, Alloc>::clear(){
+	while (_drop()){}
+}
@@ -0,0 +1,611 @@
+/*
+	RingBufferList.h - LinkedList API on top of a circular buffer
+	For FIFO queues and bounded history buffers where nodes are pure overhead:
+	objects are kept in one contiguous array, add()/unshift()/pop()/shift() are O(1)
+	at both ends, get(index) is O(1) and iteration walks memory linearly.
+	Insertion and removal in the middle move objects, up to half of the list.
+
+	RingBufferList<T> grows it's heap buffer twice when full,
+	RingBufferList<T, N> keeps N objects inside of the object and never allocates, sort() included,
+	add() returns false when it's full.
+
+	For instructions, go to https://github.com/vortigont/LinkedList
+*/
+
+#pragma once
+
+#include "LinkedList.h"
+#include <algorithm>
+
+namespace llist {
+
+/**
+ * @brief fixed storage for N objects inside of the ring buffer object
+ */
+template<typename T, size_t N>
+struct RingStorage {
+	alignas(T) unsigned char _data[N][sizeof(T)];
+
+	T* buf(){ return reinterpret_cast<T*>(_data); }
+	const T* buf() const { return reinterpret_cast<const T*>(_data); }
+	unsigned cap() const { return N; }
+
+	// fixed storage could not grow
+	static constexpr bool growable = false;
+	T* allocate(unsigned){ return nullptr; }
+	void adopt(T*, unsigned){}
+	void release(){}
+	void swap(RingStorage&){}
+};
+
+/**
+ * @brief growable heap storage
+ */
+template<typename T>
+struct RingStorage<T, 0> {
+	T *_buf = nullptr;
+	unsigned _cap = 0;
+
+	T* buf(){ return _buf; }
+	const T* buf() const { return _buf; }
+	unsigned cap() const { return _cap; }
+
+	static constexpr bool growable = true;
+	// raw memory for n objects or nullptr
+	T* allocate(unsigned n){ return static_cast<T*>(::operator new(sizeof(T) * n, std::nothrow)); }
+	// free current buffer and take a new one
+	void adopt(T *buf, unsigned n){ ::operator delete(_buf); _buf = buf; _cap = n; }
+	void release(){ adopt(nullptr, 0); }
+	void swap(RingStorage &rhs){ std::swap(_buf, rhs._buf); std::swap(_cap, rhs._cap); }
+};
+
+/**
+ * @brief passes objects which std algorithms hold by const reference to predicates taking non-const ones,
+ * those are objects of the list or of the algorithm's temporary buffer, never const ones
+ */
+template<class Less>
+struct MutableLess {
+	Less &less;
+
+	template<class A, class B>
+	bool operator()(const A &x, const B &y) const { return less(const_cast<A&>(x), const_cast<B&>(y)); }
+};
+
+/**
+ * @brief merge sorted ranges [first, middle) and [middle, last) without a buffer
+ * splits the longer range in half, rotates the parts in between and merges both halves the same way,
+ * O(n log n) moves for n objects. Objects of the first range go first if equal
+ */
+template<class It, class Less>
+void merge_in_place(It first, It middle, It last, Less &less){
+	auto len1 = middle - first;
+	auto len2 = last - middle;
+	if (!len1 || !len2)
+		return;
+
+	if (len1 + len2 == 2){
+		if (less(*middle, *first))
+			std::iter_swap(first, middle);
+		return;
+	}
+
+	It cut1, cut2;
+	if (len1 > len2){
+		// cut2 is the first object of the second range not less than *cut1
+		cut1 = first + len1 / 2;
+		cut2 = middle;
+		for (auto n = len2; n;){
+			It mid = cut2 + n / 2;
+			if (less(*mid, *cut1)){ cut2 = mid + 1; n -= n / 2 + 1; }
+			else n /= 2;
+		}
+	} else {
+		// cut1 is the first object of the first range greater than *cut2
+		cut2 = middle + len2 / 2;
+		cut1 = first;
+		for (auto n = len1; n;){
+			It mid = cut1 + n / 2;
+			if (!less(*cut2, *mid)){ cut1 = mid + 1; n -= n / 2 + 1; }
+			else n /= 2;
+		}
+	}
+
+	It newMiddle = std::rotate(cut1, middle, cut2);
+	merge_in_place(first, cut1, newMiddle, less);
+	merge_in_place(newMiddle, cut2, last, less);
+}
+
+/**
+ * @brief stable sort without allocations
+ * bottom-up merge of adjacent runs by merge_in_place(), O(n log^2 n)
+ */
+template<class It, class Less>
+void stable_sort_in_place(It first, It last, Less less){
+	auto n = last - first;
+	for (decltype(n) width = 1; width < n; width *= 2){
+		for (decltype(n) i = 0; i + width < n; i += width * 2)
+			merge_in_place(first + i, first + i + width, first + std::min(i + width * 2, n), less);
+	}
+}
+
+}	// namespace llist
+
+template <typename T, size_t N = 0>
+class RingBufferList{
+
+protected:
+	llist::RingStorage<T, N> _store;
+	// index of the first object in the buffer
+	unsigned _head = 0;
+	unsigned _size = 0;
+
+	// position in the buffer of the index'th object
+	unsigned _pos(unsigned index) const { unsigned p = _head + index; return p >= _store.cap() ? p - _store.cap() : p; }
+	T& _obj(unsigned index){ return _store.buf()[_pos(index)]; }
+	const T& _obj(unsigned index) const { return _store.buf()[_pos(index)]; }
+
+	/**
+	 * @brief make room for one more object
+	 * @return false if buffer is full and could not grow
+	 */
+	bool _reserve();
+
+	// move objects to a buffer for cap objects, they start at it's beginning
+	bool _realloc(unsigned cap);
+
+	// growable buffer is sorted with a temporary buffer, fixed one in place without allocations
+	template<class Less>
+	void _sort(Less &less, std::true_type){ std::stable_sort(begin(), end(), llist::MutableLess<Less>{less}); }
+	template<class Less>
+	void _sort(Less &less, std::false_type){ llist::stable_sort_in_place(begin(), end(), less); }
+
+public:
+	RingBufferList(){};
+	RingBufferList(unsigned sizeIndex, const T& _t); //initiate list size and default value
+	RingBufferList(const RingBufferList &rhs) : RingBufferList(){ *this = rhs; };	// clone constructor
+	RingBufferList(RingBufferList &&rhs) : RingBufferList(){ *this = std::move(rhs); };	// move constructor
+	~RingBufferList(){ clear(); _store.release(); };
+
+	/*
+		Returns current size of the list
+	*/
+	unsigned size() const { return _size; };
+
+	// number of objects that fit into the buffer without reallocation
+	unsigned capacity() const { return _store.cap(); }
+
+	/**
+	 * @brief allocate buffer for at least n objects, so adding them won't reallocate
+	 * @return false if there is no memory or the buffer is fixed and smaller than n
+	 */
+	bool reserve(unsigned n){ return n <= _store.cap() || _realloc(n); };
+
+	/*
+		Adds a T object in the specified index;
+		Returns false if the buffer is full and could not grow
+	*/
+	bool add(unsigned index, const T& _t){ return emplace(index, _t); };
+	bool add(unsigned index, T&& _t){ return emplace(index, std::move(_t)); };
+	/*
+		Adds a T object in the end of the list;
+	*/
+	bool add(const T& _t){ return emplace_back(_t); };
+	bool add(T&& _t){ return emplace_back(std::move(_t)); };
+	/*
+		Adds a T object in the start of the list;
+	*/
+	bool unshift(const T& _t){ return emplace_front(_t); };
+	bool unshift(T&& _t){ return emplace_front(std::move(_t)); };
+	/*
+		Set the object at index, with T;
+	*/
+	bool set(unsigned index, const T& _t);
+	bool set(unsigned index, T&& _t);
+
+	/**
+	 * @brief construct T object in-place from args at the specified index
+	 * objects are moved towards the closer end of the list to make room
+	 */
+	template<class... Args>
+	bool emplace(unsigned index, Args&&... args);
+
+	template<class... Args>
+	bool emplace_back(Args&&... args);
+
+	template<class... Args>
+	bool emplace_front(Args&&... args);
+
+	/*
+		Remove object at index;
+		Returns T object moved out of the list or T() if index is not reachable
+	*/
+	T remove(unsigned index);
+
+	/*
+		Delete object at index
+	*/
+	void unlink(unsigned index);
+
+	/*
+		Remove last object, O(1)
+	*/
+	T pop();
+
+	/*
+		Remove first object, O(1)
+	*/
+	T shift();
+
+	bool try_get(unsigned index, T& out) const;
+	bool try_pop(T& out);
+	bool try_shift(T& out);
+
+	/*
+		Get the index'th element on the list, O(1);
+		Return Element if accessible,
+		else, return T();
+	*/
+	T get(unsigned index) const { return index < _size ? _obj(index) : T(); };
+
+	T front() const { return _size ? _obj(0) : T(); };
+	T back() const { return _size ? _obj(_size - 1) : T(); };
+
+	// same as front()
+	T head() const { return front(); }
+
+	// same as back()
+	T tail() const { return back(); }
+
+	// references to the first/last object, list must not be empty
+	T& front_ref(){ return _obj(0); };
+	const T& front_ref() const { return _obj(0); };
+	T& back_ref(){ return _obj(_size - 1); };
+	const T& back_ref() const { return _obj(_size - 1); };
+
+	bool exist(unsigned index) const { return index < _size; };
+
+	/**
+	 * @brief delete all objects, buffer is kept
+	 */
+	void clear();
+
+	/*
+		Sort the list, given a comparison function
+	*/
+	void sort(int (*cmp)(T &, T &)){ auto &&less = llist::make_less<T>(cmp); _sort(less, std::integral_constant<bool, llist::RingStorage<T, N>::growable>()); };
+
+	/**
+	 * @brief sort the list with any callable: function, functor or lambda
+	 * stable, see LinkedList::sort(Compare&&).
+	 * Growable list is sorted by std::stable_sort, which takes a temporary buffer from the heap,
+	 * fixed one merges objects in place without allocations in O(n log^2 n)
+	 */
+	template<class Compare = std::less<> >
+	void sort(Compare &&cmp = Compare()){ auto &&less = llist::make_less<T>(cmp); _sort(less, std::integral_constant<bool, llist::RingStorage<T, N>::growable>()); };
+
+	inline T& operator[](unsigned i) { return _obj(i); }
+	inline const T& operator[](const unsigned i) const { return _obj(i); }
+
+	// deep-copy via assign operator, objects which do not fit into fixed buffer are dropped
+	RingBufferList & operator =(const RingBufferList &rhs);
+
+	// heap buffer is taken over in O(1), fixed buffer objects are moved one by one
+	RingBufferList & operator =(RingBufferList &&rhs);
+
+	/*
+		ConstIterator class
+		provides immutable random access iterator for the list
+	*/
+	struct ConstIterator {
+		using iterator_category = std::random_access_iterator_tag;
+		using difference_type   = std::ptrdiff_t;
+		using value_type        = T;
+		using pointer           = const T*;
+		using reference         = const T&;
+
+		ConstIterator(const RingBufferList *list = nullptr, unsigned index = 0) : m_list(list), m_index(index) {}
+
+		reference operator*() const { return m_list->_obj(m_index); }
+		pointer operator->() const { return &m_list->_obj(m_index); }
+		reference operator[](difference_type n) const { return m_list->_obj(m_index + n); }
+
+		ConstIterator& operator++() { ++m_index; return *this; }
+		ConstIterator operator++(int) { ConstIterator tmp = *this; ++m_index; return tmp; }
+		ConstIterator& operator--() { --m_index; return *this; }
+		ConstIterator operator--(int) { ConstIterator tmp = *this; --m_index; return tmp; }
+		ConstIterator& operator+=(difference_type n) { m_index += n; return *this; }
+		ConstIterator& operator-=(difference_type n) { m_index -= n; return *this; }
+		ConstIterator operator+(difference_type n) const { return ConstIterator(m_list, m_index + n); }
+		ConstIterator operator-(difference_type n) const { return ConstIterator(m_list, m_index - n); }
+		difference_type operator-(const ConstIterator& a) const { return difference_type(m_index) - difference_type(a.m_index); }
+
+		bool operator== (const ConstIterator& a) const { return m_index == a.m_index; };
+		bool operator!= (const ConstIterator& a) const { return m_index != a.m_index; };
+		bool operator< (const ConstIterator& a) const { return m_index < a.m_index; };
+		bool operator> (const ConstIterator& a) const { return m_index > a.m_index; };
+		bool operator<= (const ConstIterator& a) const { return m_index <= a.m_index; };
+		bool operator>= (const ConstIterator& a) const { return m_index >= a.m_index; };
+
+		protected:
+			const RingBufferList *m_list;
+			unsigned m_index;
+	};
+
+	/*
+		Iterator class
+		inherits from ConstIterator, provides mutable random access iterator for the list
+	*/
+	struct Iterator : public ConstIterator {
+		using iterator_category = std::random_access_iterator_tag;
+		using difference_type   = std::ptrdiff_t;
+		using value_type        = T;
+		using pointer           = T*;
+		using reference         = T&;
+
+		Iterator(RingBufferList *list = nullptr, unsigned index = 0) : ConstIterator(list, index) {}
+
+		reference operator*() const { return const_cast<T&>(ConstIterator::operator*()); }
+		pointer operator->() const { return &**this; }
+		reference operator[](difference_type n) const { return const_cast<T&>(ConstIterator::operator[](n)); }
+
+		Iterator& operator++() { ConstIterator::operator++(); return *this; }
+		Iterator operator++(int) { Iterator tmp = *this; ++(*this); return tmp; }
+		Iterator& operator--() { ConstIterator::operator--(); return *this; }
+		Iterator operator--(int) { Iterator tmp = *this; --(*this); return tmp; }
+		Iterator& operator+=(difference_type n) { ConstIterator::operator+=(n); return *this; }
+		Iterator& operator-=(difference_type n) { ConstIterator::operator-=(n); return *this; }
+		Iterator operator+(difference_type n) const { Iterator tmp = *this; return tmp += n; }
+		Iterator operator-(difference_type n) const { Iterator tmp = *this; return tmp -= n; }
+		difference_type operator-(const ConstIterator& a) const { return ConstIterator::operator-(a); }
+	};
+
+	// iterator methods
+	ConstIterator cbegin() const { return ConstIterator(this, 0); }
+	ConstIterator cend() const { return ConstIterator(this, _size); }
+	ConstIterator begin() const { return cbegin(); }
+	ConstIterator end() const { return cend(); }
+	Iterator begin() { return Iterator(this, 0); }
+	Iterator end() { return Iterator(this, _size); }
+};
+
+
+template<typename T, size_t N>
+RingBufferList<T, N>::RingBufferList(unsigned sizeIndex, const T& _t){
+	reserve(sizeIndex);
+	for (unsigned i = 0; i < sizeIndex; i++){
+		add(_t);
+	}
+}
+
+template<typename T, size_t N>
+bool RingBufferList<T, N>::_realloc(unsigned cap){
+	T *buf = _store.allocate(cap);
+	if (!buf)
+		return false;
+
+	for (unsigned i = 0; i != _size; ++i){
+		new (buf + i) T(std::move(_obj(i)));
+		_obj(i).~T();
+	}
+
+	_store.adopt(buf, cap);
+	_head = 0;
+	return true;
+}
+
+template<typename T, size_t N>
+bool RingBufferList<T, N>::_reserve(){
+	if (_size < _store.cap())
+		return true;
+
+	return _realloc(_store.cap() ? _store.cap() * 2 : 4);
+}
+
+template<typename T, size_t N>
+template<class... Args>
+bool RingBufferList<T, N>::emplace(unsigned index, Args&&... args){
+	if (index >= _size)
+		return emplace_back(std::forward<Args>(args)...);
+
+	if (!index)
+		return emplace_front(std::forward<Args>(args)...);
+
+	// args could refer to an object in the list, so it's constructed before objects are moved
+	T obj(std::forward<Args>(args)...);
+	if (!_reserve())
+		return false;
+
+	if (index < _size / 2){
+		// first object is duplicated at the front, objects before index are moved one step back
+		emplace_front(std::move(_obj(0)));
+		for (unsigned i = 1; i != index; ++i)
+			_obj(i) = std::move(_obj(i + 1));
+	} else {
+		emplace_back(std::move(_obj(_size - 1)));
+		for (unsigned i = _size - 2; i != index; --i)
+			_obj(i) = std::move(_obj(i - 1));
+	}
+
+	_obj(index) = std::move(obj);
+	return true;
+}
+
+template<typename T, size_t N>
+template<class... Args>
+bool RingBufferList<T, N>::emplace_back(Args&&... args){
+	if (_size == _store.cap()){
+		// args could refer to an object in the buffer, construct it before reallocation
+		if (!_store.growable)
+			return false;
+
+		T obj(std::forward<Args>(args)...);
+		return _reserve() && emplace_back(std::move(obj));
+	}
+
+	new (_store.buf() + _pos(_size)) T(std::forward<Args>(args)...);
+	++_size;
+	return true;
+}
+
+template<typename T, size_t N>
+template<class... Args>
+bool RingBufferList<T, N>::emplace_front(Args&&... args){
+	if (_size == _store.cap()){
+		// args could refer to an object in the buffer, construct it before reallocation
+		if (!_store.growable)
+			return false;
+
+		T obj(std::forward<Args>(args)...);
+		return _reserve() && emplace_front(std::move(obj));
+	}
+
+	unsigned head = _head ? _head - 1 : _store.cap() - 1;
+	new (_store.buf() + head) T(std::forward<Args>(args)...);
+	_head = head;
+	++_size;
+	return true;
+}
+
+template<typename T, size_t N>
+bool RingBufferList<T, N>::set(unsigned index, const T& _t){
+	if (index >= _size)
+		return false;
+
+	_obj(index) = _t;
+	return true;
+}
+
+template<typename T, size_t N>
+bool RingBufferList<T, N>::set(unsigned index, T&& _t){
+	if (index >= _size)
+		return false;
+
+	_obj(index) = std::move(_t);
+	return true;
+}
+
+template<typename T, size_t N>
+T RingBufferList<T, N>::remove(unsigned index){
+	if (index >= _size)
+		return T();
+
+	T ret(std::move(_obj(index)));
+	unlink(index);
+	return ret;
+}
+
+template<typename T, size_t N>
+void RingBufferList<T, N>::unlink(unsigned index){
+	if (index >= _size)
+		return;
+
+	// close the gap from the closer end, then drop the end object
+	if (index < _size / 2){
+		for (unsigned i = index; i; --i)
+			_obj(i) = std::move(_obj(i - 1));
+
+		_obj(0).~T();
+		_head = _pos(1);
+	} else {
+		for (unsigned i = index; i + 1 < _size; ++i)
+			_obj(i) = std::move(_obj(i + 1));
+
+		_obj(_size - 1).~T();
+	}
+
+	if (!--_size)
+		_head = 0;
+}
+
+template<typename T, size_t N>
+T RingBufferList<T, N>::pop(){
+	if (!_size)
+		return T();
+
+	T ret(std::move(_obj(_size - 1)));
+	unlink(_size - 1);
+	return ret;
+}
+
+template<typename T, size_t N>
+T RingBufferList<T, N>::shift(){
+	if (!_size)
+		return T();
+
+	T ret(std::move(_obj(0)));
+	unlink(0);
+	return ret;
+}
+
+template<typename T, size_t N>
+bool RingBufferList<T, N>::try_get(unsigned index, T& out) const {
+	if (index >= _size)
+		return false;
+
+	out = _obj(index);
+	return true;
+}
+
+template<typename T, size_t N>
+bool RingBufferList<T, N>::try_pop(T& out){
+	if (!_size)
+		return false;
+
+	out = std::move(_obj(_size - 1));
+	unlink(_size - 1);
+	return true;
+}
+
+template<typename T, size_t N>
+bool RingBufferList<T, N>::try_shift(T& out){
+	if (!_size)
+		return false;
+
+	out = std::move(_obj(0));
+	unlink(0);
+	return true;
+}
+
+template<typename T, size_t N>
+void RingBufferList<T, N>::clear(){
+	for (unsigned i = 0; i != _size; ++i)
+		_obj(i).~T();
+
+	_size = _head = 0;
+}
+
+template<typename T, size_t N>
+RingBufferList<T, N>& RingBufferList<T, N>::operator =(const RingBufferList& rhs){
+	if (this == &rhs)
+		return *this;
+
+	clear();
+	reserve(rhs._size);
+	for (const auto& i : rhs)
+		if (!add(i))
+			break;
+
+	return *this;
+}
+
+template<typename T, size_t N>
+RingBufferList<T, N>& RingBufferList<T, N>::operator =(RingBufferList&& rhs){
+	if (this == &rhs)
+		return *this;
+
+	clear();
+
+	if (_store.growable){
+		_store.swap(rhs._store);
+		std::swap(_head, rhs._head);
+		std::swap(_size, rhs._size);
+		return *this;
+	}
+
+	// fixed buffers, move objects one by one
+	for (auto& i : rhs)
+		add(std::move(i));
+	rhs.clear();
+
+	return *this;
+}
@@ -0,0 +1,97 @@
+/*
+	SortedLinkedList.h - LinkedList keeping objects in order
+	Every add() inserts an object after all objects not greater than it,
+	so there is no need to sort the list after adding objects.
+	Adding objects in order is O(1), and insertions close to the previous one
+	start walking from the node cache, not from the start of the list.
+	Sorted lists are merged in one pass without allocations.
+
+	Objects are accessible read-only via iterators and references,
+	changing them in place could break the order.
+
+	For instructions, go to https://github.com/vortigont/LinkedList
+*/
+
+#pragma once
+
+#include "LinkedList.h"
+
+/**
+ * @brief LinkedList with objects sorted by Compare
+ * @tparam Compare - 'less' predicate returning bool, or strcmp-like comparator returning int
+ */
+template <typename T, class Compare = std::less<>, class Alloc = NodeHeapAllocator< ListNode<T> > >
+class SortedLinkedList {
+	using list_t = LinkedListCore<T, Alloc>;
+
+protected:
+	list_t _list;
+	Compare _cmp;
+
+public:
+	SortedLinkedList(Compare cmp = Compare()) : _cmp(cmp) {};
+
+	/*
+		Read methods, same as LinkedList ones
+	*/
+	unsigned size() const { return _list.size(); };
+	T get(unsigned index) const { return _list.get(index); };
+	T front() const { return _list.front(); };
+	T back() const { return _list.back(); };
+	bool exist(unsigned index) const { return _list.exist(index); };
+	bool try_get(unsigned index, T& out) const { return _list.try_get(index, out); };
+	bool contains(const T& value) const { return _list.contains(value); };
+	int index_of(const T& value) const { return _list.index_of(value); };
+
+	const T& operator[](unsigned i) const { return _list[i]; }
+
+	// objects found are read-only, changing them could break the order
+	const T* find(const T& value) const { return _list.find(value); }
+	template<class Pred>
+	const T* find_if(Pred pred) const { return _list.find_if(pred); }
+
+	/*
+		Removal keeps the order
+	*/
+	T remove(unsigned index){ return _list.remove(index); };
+	void unlink(unsigned index){ _list.unlink(index); };
+	T pop(){ return _list.pop(); };
+	T shift(){ return _list.shift(); };
+	bool try_pop(T& out){ return _list.try_pop(out); };
+	bool try_shift(T& out){ return _list.try_shift(out); };
+	void clear(){ _list.clear(); };
+	template<class Pred>
+	unsigned remove_if(Pred pred){ return _list.remove_if(pred); };
+	unsigned erase_range(unsigned from, unsigned to){ return _list.erase_range(from, to); };
+	template<class BinaryPred = std::equal_to<> >
+	unsigned unique(BinaryPred eq = BinaryPred()){ return _list.unique(eq); };
+
+	/**
+	 * @brief insert object after all objects not greater than it
+	 * @return false if allocator has no free nodes
+	 */
+	bool add(const T& _t){ return _list.insert_sorted(_t, _cmp); };
+	bool add(T&& _t){ return _list.insert_sorted(std::move(_t), _cmp); };
+
+	/**
+	 * @brief merge other sorted list in one pass, other list becomes empty
+	 * objects of this list go first if equal
+	 * @return false if allocator has no free nodes, objects moved so far stay in this list
+	 */
+	bool merge(SortedLinkedList &other){ return _list.merge(other._list, _cmp); };
+	bool merge(SortedLinkedList &&other){ return _list.merge(other._list, _cmp); };
+
+	/**
+	 * @brief index of the first object not less than / greater than value
+	 * @return size() if there is no such object
+	 */
+	unsigned lower_bound(const T& value) const { return _list.lower_bound(value, _cmp); };
+	unsigned upper_bound(const T& value) const { return _list.upper_bound(value, _cmp); };
+
+	// objects are immutable via iterators, the order must not change behind the list
+	using ConstIterator = typename list_t::ConstIterator;
+	ConstIterator cbegin() const { return _list.cbegin(); }
+	ConstIterator cend() const { return _list.cend(); }
+	ConstIterator begin() const { return _list.cbegin(); }
+	ConstIterator end() const { return _list.cend(); }
+};
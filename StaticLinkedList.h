@@ -0,0 +1,497 @@
+/*
+	StaticLinkedList.h - Fixed-capacity LinkedList with no heap at all
+	Shares LinkedList API, all N nodes live inside of the object.
+	Nodes are linked via 8-bit (N < 256) or 16-bit indexes instead of pointers,
+	links and objects are kept in separate arrays, so per-node overhead
+	is 1 or 2 bytes and small objects are not padded to pointer's alignment.
+
+	For instructions, go to https://github.com/vortigont/LinkedList
+*/
+
+#pragma once
+
+#include "LinkedList.h"
+#include <stdint.h>
+
+template <typename T, size_t N>
+class StaticLinkedList{
+	static_assert(N > 0 && N < 65536, "StaticLinkedList capacity must be in range 1..65535");
+
+public:
+	// node link type, nodes are numbered from 1, 0 is a null link
+	using index_t = typename std::conditional<(N < 256), uint8_t, uint16_t>::type;
+
+protected:
+	// link to the next node for each node
+	index_t _next[N];
+	// objects storage
+	alignas(T) unsigned char _data[N][sizeof(T)];
+
+	index_t _size = 0;
+	index_t root = 0;
+	index_t last = 0;
+	// released nodes chain
+	index_t _free = 0;
+	// number of nodes ever taken, nodes above it are free
+	index_t _top = 0;
+
+	// Helps "get" method, by saving last position
+	mutable index_t lastNodeGot = 0;
+	mutable index_t lastIndexGot = 0;
+
+	// node access for llist::sort_chain()
+	struct Links {
+		StaticLinkedList *list;
+		index_t& next(index_t node){ return list->_next[node - 1]; }
+		T& data(index_t node){ return list->_obj(node); }
+	};
+
+	T& _obj(index_t node){ return *reinterpret_cast<T*>(_data[node - 1]); }
+	const T& _obj(index_t node) const { return *reinterpret_cast<const T*>(_data[node - 1]); }
+	index_t& _link(index_t node){ return _next[node - 1]; }
+
+	index_t getNode(unsigned index) const;
+
+	/**
+	 * @brief take a free node and construct object from args in it
+	 * @return node or 0 if list is full
+	 */
+	template<class... Args>
+	index_t _newNode(Args&&... args);
+
+	/**
+	 * @brief destruct object and put node to the free chain
+	 */
+	void _freeNode(index_t node);
+
+	/**
+	 * @brief sort nodes with a 'less' predicate
+	 */
+	template<class Less>
+	void _sort(Less &&less);
+
+public:
+	StaticLinkedList(){};
+	StaticLinkedList(unsigned sizeIndex, const T& _t); //initiate list size and default value
+	StaticLinkedList(const StaticLinkedList &rhs) : StaticLinkedList(){ *this = rhs; };	// clone constructor
+	// nodes are inline, so objects are moved one by one
+	StaticLinkedList(StaticLinkedList &&rhs) : StaticLinkedList(){ *this = std::move(rhs); };
+	~StaticLinkedList(){ clear(); };
+
+	/*
+		Returns current size of the list
+	*/
+	unsigned size() const { return _size; };
+
+	// max number of objects in the list
+	static constexpr unsigned capacity(){ return N; }
+
+	// number of objects that could be added
+	unsigned available() const { return N - _size; };
+
+	/*
+		Adds a T object in the specified index;
+		Returns false if the list is full
+	*/
+	bool add(unsigned index, const T& _t){ return emplace(index, _t); };
+	bool add(unsigned index, T&& _t){ return emplace(index, std::move(_t)); };
+	/*
+		Adds a T object in the end of the list;
+		Returns false if the list is full
+	*/
+	bool add(const T& _t){ return emplace_back(_t); };
+	bool add(T&& _t){ return emplace_back(std::move(_t)); };
+	/*
+		Adds a T object in the start of the list;
+		Returns false if the list is full
+	*/
+	bool unshift(const T& _t){ return emplace_front(_t); };
+	bool unshift(T&& _t){ return emplace_front(std::move(_t)); };
+	/*
+		Set the object at index, with T;
+	*/
+	bool set(unsigned index, const T& _t);
+	bool set(unsigned index, T&& _t);
+
+	/**
+	 * @brief construct T object in-place from args at the specified index
+	 */
+	template<class... Args>
+	bool emplace(unsigned index, Args&&... args);
+
+	template<class... Args>
+	bool emplace_back(Args&&... args);
+
+	template<class... Args>
+	bool emplace_front(Args&&... args);
+
+	/*
+		Remove node at index;
+		Returns T object moved out of removed node or T() if index is not reachable
+	*/
+	T remove(unsigned index);
+
+	/*
+		Unlink and delete node at index
+	*/
+	void unlink(unsigned index);
+
+	/*
+		Remove last object;
+		Returns T object moved out of removed node
+	*/
+	T pop();
+
+	/*
+		Remove first object;
+		Returns T object moved out of removed node
+	*/
+	T shift();
+
+	/*
+		Get the index'th element on the list;
+		Return Element if accessible,
+		else, return T();
+	*/
+	T get(unsigned index) const;
+
+	T front() const { return _size ? _obj(root) : T(); };
+	T back() const { return _size ? _obj(last) : T(); };
+
+	// same as front()
+	T head() const { return front(); }
+
+	// same as back()
+	T tail() const { return back(); }
+
+	bool exist(unsigned index) const { return index < _size; };
+
+	/**
+	 * @brief delete all objects and release all nodes
+	 */
+	void clear();
+
+	/*
+		Sort the list, given a comparison function
+	*/
+	void sort(int (*cmp)(T &, T &));
+
+	/**
+	 * @brief sort the list with any callable: function, functor or lambda
+	 * stable, see LinkedList::sort(Compare&&)
+	 */
+	template<class Compare = std::less<> >
+	void sort(Compare &&cmp = Compare());
+
+	inline T& operator[](unsigned i) { return _obj(getNode(i)); }
+	inline const T& operator[](const unsigned i) const { return _obj(getNode(i)); }
+
+	// deep-copy via assign operator, objects which do not fit are dropped
+	StaticLinkedList & operator =(const StaticLinkedList &rhs);
+
+	// objects are moved one by one, rhs becomes empty
+	StaticLinkedList & operator =(StaticLinkedList &&rhs);
+
+	/*
+		ConstIterator class
+		provides immutable forward iterator for the list
+	*/
+	struct ConstIterator {
+		using iterator_category = std::forward_iterator_tag;
+		using difference_type   = std::ptrdiff_t;
+		using value_type        = T;
+		using pointer           = const T*;
+		using reference         = const T&;
+
+		ConstIterator(const StaticLinkedList *list = nullptr, index_t node = 0) : m_list(list), m_node(node) {}
+
+		reference operator*() const { return m_list->_obj(m_node); }
+		pointer operator->() const { return &m_list->_obj(m_node); }
+
+		// Prefix increment
+		ConstIterator& operator++() { m_node = m_list->_next[m_node - 1]; return *this; }
+
+		// Postfix increment
+		ConstIterator operator++(int) { ConstIterator tmp = *this; ++(*this); return tmp; }
+
+		bool operator== (const ConstIterator& a) const { return m_node == a.m_node; };
+		bool operator!= (const ConstIterator& a) const { return m_node != a.m_node; };
+
+		protected:
+			const StaticLinkedList *m_list;
+			index_t m_node;
+	};
+
+	/*
+		Iterator class
+		inherits from ConstIterator, provides mutable forward iterator for the list
+	*/
+	struct Iterator : public ConstIterator {
+		using iterator_category = std::forward_iterator_tag;
+		using difference_type   = std::ptrdiff_t;
+		using value_type        = T;
+		using pointer           = T*;
+		using reference         = T&;
+
+		Iterator(StaticLinkedList *list = nullptr, index_t node = 0) : ConstIterator(list, node) {}
+
+		reference operator*() const { return const_cast<T&>(ConstIterator::operator*()); }
+		pointer operator->() const { return &**this; }
+
+		Iterator& operator++() { ConstIterator::operator++(); return *this; }
+		Iterator operator++(int) { Iterator tmp = *this; ++(*this); return tmp; }
+	};
+
+	// iterator methods
+	ConstIterator cbegin() const { return ConstIterator(this, root); }
+	ConstIterator cend() const { return ConstIterator(this, 0); }
+	ConstIterator begin() const { return cbegin(); }
+	ConstIterator end() const { return cend(); }
+	Iterator begin() { return Iterator(this, root); }
+	Iterator end() { return Iterator(this, 0); }
+};
+
+
+template<typename T, size_t N>
+StaticLinkedList<T, N>::StaticLinkedList(unsigned sizeIndex, const T& _t){
+	for (unsigned i = 0; i < sizeIndex; i++){
+		add(_t);
+	}
+}
+
+template<typename T, size_t N>
+typename StaticLinkedList<T, N>::index_t StaticLinkedList<T, N>::getNode(unsigned index) const {
+	if (index >= _size)
+		return 0;
+
+	if (!index)
+		return root;
+
+	if (index + 1 == _size)
+		return last;
+
+	unsigned _pos = 0;
+	index_t current = root;
+
+	if (lastIndexGot <= index && lastNodeGot){
+		_pos = lastIndexGot;
+		current = lastNodeGot;
+	}
+
+	while (_pos < index){
+		current = _next[current - 1];
+		++_pos;
+	}
+
+	lastIndexGot = index;
+	lastNodeGot = current;
+	return current;
+}
+
+template<typename T, size_t N>
+template<class... Args>
+typename StaticLinkedList<T, N>::index_t StaticLinkedList<T, N>::_newNode(Args&&... args){
+	index_t node;
+	if (_free){
+		node = _free;
+		_free = _link(node);
+	} else if (_top < N)
+		node = ++_top;
+	else
+		return 0;
+
+	new (_data[node - 1]) T(std::forward<Args>(args)...);
+	return node;
+}
+
+template<typename T, size_t N>
+void StaticLinkedList<T, N>::_freeNode(index_t node){
+	_obj(node).~T();
+	_link(node) = _free;
+	_free = node;
+}
+
+template<typename T, size_t N>
+template<class... Args>
+bool StaticLinkedList<T, N>::emplace(unsigned index, Args&&... args){
+	if (index >= _size)
+		return emplace_back(std::forward<Args>(args)...);
+
+	if (!index)
+		return emplace_front(std::forward<Args>(args)...);
+
+	index_t node = _newNode(std::forward<Args>(args)...);
+	if (!node)
+		return false;
+
+	index_t prev = getNode(index - 1);
+	_link(node) = _link(prev);
+	_link(prev) = node;
+	++_size;
+
+	lastNodeGot = node;
+	lastIndexGot = index;
+	return true;
+}
+
+template<typename T, size_t N>
+template<class... Args>
+bool StaticLinkedList<T, N>::emplace_back(Args&&... args){
+	index_t node = _newNode(std::forward<Args>(args)...);
+	if (!node)
+		return false;
+
+	_link(node) = 0;
+	if (last)
+		_link(last) = node;
+	else
+		root = node;
+
+	last = lastNodeGot = node;
+	lastIndexGot = _size++;
+	return true;
+}
+
+template<typename T, size_t N>
+template<class... Args>
+bool StaticLinkedList<T, N>::emplace_front(Args&&... args){
+	index_t node = _newNode(std::forward<Args>(args)...);
+	if (!node)
+		return false;
+
+	_link(node) = root;
+	root = lastNodeGot = node;
+	if (!last)
+		last = node;
+
+	lastIndexGot = 0;
+	++_size;
+	return true;
+}
+
+template<typename T, size_t N>
+bool StaticLinkedList<T, N>::set(unsigned index, const T& _t){
+	if (index >= _size)
+		return false;
+
+	_obj(getNode(index)) = _t;
+	return true;
+}
+
+template<typename T, size_t N>
+bool StaticLinkedList<T, N>::set(unsigned index, T&& _t){
+	if (index >= _size)
+		return false;
+
+	_obj(getNode(index)) = std::move(_t);
+	return true;
+}
+
+template<typename T, size_t N>
+T StaticLinkedList<T, N>::remove(unsigned index){
+	if (index >= _size)
+		return T();
+
+	T ret(std::move(_obj(getNode(index))));
+	unlink(index);
+	return ret;
+}
+
+template<typename T, size_t N>
+void StaticLinkedList<T, N>::unlink(unsigned index){
+	if (index >= _size)
+		return;
+
+	index_t prev = index ? getNode(index - 1) : 0;
+	index_t node = prev ? _link(prev) : root;
+
+	if (prev)
+		_link(prev) = _link(node);
+	else
+		root = _link(node);
+
+	if (last == node)
+		last = prev;
+
+	_freeNode(node);
+	--_size;
+
+	lastNodeGot = prev ? prev : root;
+	lastIndexGot = prev ? index - 1 : 0;
+}
+
+template<typename T, size_t N>
+T StaticLinkedList<T, N>::pop(){
+	return _size ? remove(_size - 1) : T();
+}
+
+template<typename T, size_t N>
+T StaticLinkedList<T, N>::shift(){
+	return _size ? remove(0) : T();
+}
+
+template<typename T, size_t N>
+T StaticLinkedList<T, N>::get(unsigned index) const {
+	index_t node = getNode(index);
+	return node ? _obj(node) : T();
+}
+
+template<typename T, size_t N>
+void StaticLinkedList<T, N>::clear(){
+	for (index_t node = root; node; ){
+		index_t _n = _link(node);
+		_obj(node).~T();
+		node = _n;
+	}
+
+	// all nodes are free again
+	root = last = lastNodeGot = 0;
+	_size = lastIndexGot = 0;
+	_free = _top = 0;
+}
+
+template<typename T, size_t N>
+void StaticLinkedList<T, N>::sort(int (*cmp)(T &, T &)){
+	_sort(llist::make_less<T>(cmp));
+}
+
+template<typename T, size_t N>
+template<class Compare>
+void StaticLinkedList<T, N>::sort(Compare &&cmp){
+	_sort(llist::make_less<T>(cmp));
+}
+
+template<typename T, size_t N>
+template<class Less>
+void StaticLinkedList<T, N>::_sort(Less &&less){
+	if (_size < 2) return; // trivial case;
+
+	last = llist::sort_chain(root, less, Links{this});
+	lastNodeGot = root;
+	lastIndexGot = 0;
+}
+
+template<typename T, size_t N>
+StaticLinkedList<T, N>& StaticLinkedList<T, N>::operator =(const StaticLinkedList& rhs){
+	if (this == &rhs)
+		return *this;
+
+	clear();
+	for (const auto& i : rhs)
+		add(i);
+
+	return *this;
+}
+
+template<typename T, size_t N>
+StaticLinkedList<T, N>& StaticLinkedList<T, N>::operator =(StaticLinkedList&& rhs){
+	if (this == &rhs)
+		return *this;
+
+	clear();
+	for (auto& i : rhs)
+		emplace_back(std::move(i));
+	rhs.clear();
+
+	return *this;
+}
@@ -0,0 +1,699 @@
+/*
+	UnrolledLinkedList.h - Generic unrolled linked list implementation
+	Shares LinkedList API, but each node keeps up to N objects in a small inline array,
+	so small objects do not pay pointer and allocator overhead per each element
+	and list traversal touches far less cache lines
+
+	For instructions, go to https://github.com/vortigont/LinkedList
+*/
+
+#pragma once
+
+#include "LinkedList.h"
+
+template<class T, unsigned N>
+struct UnrolledNode
+{
+	static_assert(N > 1 && N < 256, "UnrolledNode capacity must be in range 2..255");
+
+	UnrolledNode<T, N> *next = nullptr;
+	// number of constructed objects in storage
+	unsigned char count = 0;
+	alignas(T) unsigned char storage[sizeof(T) * N];
+
+	T* items(){ return reinterpret_cast<T*>(storage); }
+	const T* items() const { return reinterpret_cast<const T*>(storage); }
+};
+
+template <typename T, unsigned N = 8, class Alloc = NodeHeapAllocator< UnrolledNode<T, N> > >
+class UnrolledLinkedList{
+
+protected:
+	using node_t = UnrolledNode<T, N>;
+
+	Alloc _alloc;
+	unsigned _size = 0;
+	node_t *root = nullptr;
+	node_t *last = nullptr;
+
+	// Helps "get" method, by saving last node and index of it's first object
+	mutable node_t *lastNodeGot = nullptr;
+	mutable unsigned lastIndexGot=0;
+
+	/**
+	 * @brief find node holding object at index
+	 * @param base - returns index of the first object in the node
+	 */
+	node_t* getNode(unsigned index, unsigned &base) const;
+
+	// node that links to the specified one, nullptr for root
+	node_t* _prevNode(node_t *node) const;
+
+	// take new empty node from allocator
+	node_t* _newNode();
+
+	// return empty node back to allocator
+	void _freeNode(node_t *node);
+
+	/**
+	 * @brief construct object at offset of the node, splits full node in halves
+	 * @param base - index of the first object in the node
+	 */
+	template<class... Args>
+	bool _insert(node_t *node, unsigned base, unsigned offset, Args&&... args);
+
+	/**
+	 * @brief destruct object at offset of the node, frees empty node or merges it with next one
+	 * @param base - index of the first object in the node
+	 */
+	void _erase(node_t *node, unsigned base, unsigned offset);
+
+	// stable sort of element indexes via bottom-up merge
+	template<class Less>
+	static unsigned* _sortIndex(unsigned *idx, unsigned *tmp, unsigned n, T **addr, Less &less);
+
+	/**
+	 * @brief sort objects with a 'less' predicate
+	 */
+	template<class Less>
+	void _sort(Less &&less);
+
+public:
+	UnrolledLinkedList(){};
+	UnrolledLinkedList(unsigned sizeIndex, const T& _t); //initiate list size and default value
+	UnrolledLinkedList(const UnrolledLinkedList &rhs) : UnrolledLinkedList(){ *this = rhs; };	// clone constructor
+	UnrolledLinkedList(UnrolledLinkedList &&rhs) : UnrolledLinkedList(){ *this = std::move(rhs); };	// move constructor
+	~UnrolledLinkedList(){ clear(); };
+
+	/*
+		Returns current size of UnrolledLinkedList
+	*/
+	unsigned size() const { return _size; };
+
+	/*
+		Adds a T object in the specified index;
+		Returns false if allocator has no free nodes
+	*/
+	bool add(unsigned index, const T& _t){ return emplace(index, _t); };
+	bool add(unsigned index, T&& _t){ return emplace(index, std::move(_t)); };
+
+	/*
+		Adds a T object in the end of the list;
+	*/
+	bool add(const T& _t){ return emplace_back(_t); };
+	bool add(T&& _t){ return emplace_back(std::move(_t)); };
+
+	/*
+		Adds a T object in the start of the list;
+	*/
+	bool unshift(const T& _t){ return emplace_front(_t); };
+	bool unshift(T&& _t){ return emplace_front(std::move(_t)); };
+
+	/*
+		Set the object at index, with T;
+	*/
+	bool set(unsigned index, const T& _t);
+	bool set(unsigned index, T&& _t);
+
+	/**
+	 * @brief construct T object in-place from args at the specified index
+	 */
+	template<class... Args>
+	bool emplace(unsigned index, Args&&... args);
+
+	/**
+	 * @brief construct T object in-place from args in the end of the list
+	 */
+	template<class... Args>
+	bool emplace_back(Args&&... args);
+
+	/**
+	 * @brief construct T object in-place from args in the start of the list
+	 */
+	template<class... Args>
+	bool emplace_front(Args&&... args);
+
+	/*
+		Remove object at index;
+		Returns T object moved out of the list or T() if index is not reachable
+	*/
+	T remove(unsigned index);
+
+	/*
+		Delete object at index;
+	*/
+	void unlink(unsigned index);
+
+	/*
+		Remove last object;
+		Returns T object moved out of the list
+	*/
+	T pop();
+
+	/**
+	 * @brief 		Remove first object
+	 *	Returns T object moved out of the list
+	 */
+	T shift();
+
+	/*
+		Get the index'th element on the list;
+		Return Element if accessible,
+		else, return T();
+	*/
+	T get(unsigned index) const;
+
+	// Get first element of the list or T() if list is empty
+	T front() const { return _size ? root->items()[0] : T(); };
+
+	// Get last element of the list or T() if list is empty
+	T back() const { return _size ? last->items()[last->count - 1] : T(); };
+
+	// same as front()
+	T head() const { return front(); }
+
+	// same as back()
+	T tail() const { return back(); }
+
+	/*
+		Return true if element with specified index exist
+	*/
+	bool exist(unsigned index) const { return index < _size; };
+
+	/**
+	 * @brief clear the list
+	 * NOTE: same as LinkedList::clear() stored pointers are not deleted
+	 */
+	void clear();
+
+	/*
+		Sort the list, given a comparison function
+		uses temporary index of n pointers and 2n unsigned,
+		falls back to in-place bubble sort if there is no memory for it
+	*/
+	void sort(int (*cmp)(T &, T &));
+
+	/**
+	 * @brief sort the list with any callable: function, functor or lambda
+	 * stable, see LinkedList::sort(Compare&&)
+	 */
+	template<class Compare = std::less<> >
+	void sort(Compare &&cmp = Compare());
+
+	inline T& operator[](unsigned i) { unsigned base; node_t *node = getNode(i, base); return node->items()[i - base]; }
+	inline const T& operator[](const unsigned i) const { unsigned base; const node_t *node = getNode(i, base); return node->items()[i - base]; }
+
+	// deep-copy via assign operator
+	UnrolledLinkedList & operator =(const UnrolledLinkedList &rhs);
+
+	// move assignment, takes over nodes chain of rhs if allocator allows it,
+	// otherwise moves objects one by one, objects left when allocator has no free nodes stay in rhs
+	UnrolledLinkedList & operator =(UnrolledLinkedList &&rhs);
+
+	/*
+		ConstIterator class
+		provides immutable forward iterator for the list
+	*/
+	struct ConstIterator {
+		using iterator_category = std::forward_iterator_tag;
+		using difference_type   = std::ptrdiff_t;
+		using value_type        = T;
+		using pointer           = const T*;
+		using reference         = const T&;
+
+		ConstIterator(node_t *ptr = nullptr) : m_ptr(ptr) {}
+
+		reference operator*() const { return m_ptr->items()[m_offset]; }
+		pointer operator->() const { return &m_ptr->items()[m_offset]; }
+
+		// Prefix increment
+		ConstIterator& operator++() { if (++m_offset == m_ptr->count){ m_ptr = m_ptr->next; m_offset = 0; } return *this; }
+
+		// Postfix increment
+		ConstIterator operator++(int) { ConstIterator tmp = *this; ++(*this); return tmp; }
+
+		bool operator== (const ConstIterator& a) const { return m_ptr == a.m_ptr && m_offset == a.m_offset; };
+		bool operator!= (const ConstIterator& a) const { return !(*this == a); };
+
+		friend UnrolledLinkedList;
+
+		protected:
+			node_t *m_ptr;
+			unsigned m_offset = 0;
+	};
+
+	/*
+		Iterator class
+		inherits from ConstIterator, provides mutable forward iterator for the list
+	*/
+	struct Iterator : public ConstIterator {
+		using iterator_category = std::forward_iterator_tag;
+		using difference_type   = std::ptrdiff_t;
+		using value_type        = T;
+		using pointer           = T*;
+		using reference         = T&;
+
+		Iterator(node_t *ptr = nullptr) : ConstIterator(ptr) {}
+
+		reference operator*() const { return this->m_ptr->items()[this->m_offset]; }
+		pointer operator->() const { return &this->m_ptr->items()[this->m_offset]; }
+
+		Iterator& operator++() { ConstIterator::operator++(); return *this; }
+		Iterator operator++(int) { Iterator tmp = *this; ++(*this); return tmp; }
+	};
+
+	// iterator methods
+	ConstIterator cbegin() const { return ConstIterator(root); }
+	ConstIterator cend() const { return ConstIterator(nullptr); }
+	ConstIterator begin() const { return cbegin(); }
+	ConstIterator end() const { return cend(); }
+	Iterator begin() { return Iterator(root); }
+	Iterator end() { return Iterator(nullptr); }
+};
+
+
+template<typename T, unsigned N, class Alloc>
+UnrolledLinkedList<T, N, Alloc>::UnrolledLinkedList(unsigned sizeIndex, const T& _t){
+	for (unsigned i = 0; i < sizeIndex; i++){
+		add(_t);
+	}
+}
+
+template<typename T, unsigned N, class Alloc>
+UnrolledNode<T, N>* UnrolledLinkedList<T, N, Alloc>::getNode(unsigned index, unsigned &base) const {
+	if (index >= _size)
+		return nullptr;
+
+	node_t *current = root;
+	base = 0;
+
+	if (index >= _size - last->count){
+		current = last;
+		base = _size - last->count;
+	} else if (lastNodeGot && lastIndexGot <= index){
+		// move forward from the cached node
+		current = lastNodeGot;
+		base = lastIndexGot;
+	}
+
+	while (index >= base + current->count){
+		base += current->count;
+		current = current->next;
+	}
+
+	lastNodeGot = current;
+	lastIndexGot = base;
+	return current;
+}
+
+template<typename T, unsigned N, class Alloc>
+UnrolledNode<T, N>* UnrolledLinkedList<T, N, Alloc>::_prevNode(node_t *node) const {
+	if (node == root)
+		return nullptr;
+
+	node_t *current = root;
+	while (current->next != node)
+		current = current->next;
+
+	return current;
+}
+
+template<typename T, unsigned N, class Alloc>
+UnrolledNode<T, N>* UnrolledLinkedList<T, N, Alloc>::_newNode(){
+	node_t *node = _alloc.allocate();
+	return node ? new (node) node_t() : nullptr;
+}
+
+template<typename T, unsigned N, class Alloc>
+void UnrolledLinkedList<T, N, Alloc>::_freeNode(node_t *node){
+	node->~node_t();
+	_alloc.deallocate(node);
+}
+
+template<typename T, unsigned N, class Alloc>
+template<class... Args>
+bool UnrolledLinkedList<T, N, Alloc>::_insert(node_t *node, unsigned base, unsigned offset, Args&&... args){
+	// args might refer to the list's own object that is about to move, so make a temporary first
+	T obj(std::forward<Args>(args)...);
+
+	if (node->count == N){
+		// split full node, upper half goes to a new one
+		node_t *fresh = _newNode();
+		if (!fresh)
+			return false;
+
+		const unsigned half = N / 2;
+		T *src = node->items();
+		T *dst = fresh->items();
+		for (unsigned i = half; i != N; ++i){
+			new (dst + i - half) T(std::move(src[i]));
+			src[i].~T();
+		}
+
+		fresh->count = N - half;
+		node->count = half;
+		fresh->next = node->next;
+		node->next = fresh;
+		if (last == node)
+			last = fresh;
+
+		if (offset > half){
+			node = fresh;
+			base += half;
+			offset -= half;
+		}
+	}
+
+	T *it = node->items();
+	for (unsigned i = node->count; i > offset; --i){
+		new (it + i) T(std::move(it[i - 1]));
+		it[i - 1].~T();
+	}
+	new (it + offset) T(std::move(obj));
+
+	++node->count;
+	++_size;
+	lastNodeGot = node;
+	lastIndexGot = base;
+	return true;
+}
+
+template<typename T, unsigned N, class Alloc>
+void UnrolledLinkedList<T, N, Alloc>::_erase(node_t *node, unsigned base, unsigned offset){
+	T *it = node->items();
+	it[offset].~T();
+	for (unsigned i = offset + 1; i < node->count; ++i){
+		new (it + i - 1) T(std::move(it[i]));
+		it[i].~T();
+	}
+	--node->count;
+	--_size;
+
+	if (!node->count){
+		node_t *_prev = _prevNode(node);
+		if (_prev)
+			_prev->next = node->next;
+		else
+			root = node->next;
+
+		if (last == node)
+			last = _prev;
+
+		_freeNode(node);
+
+		if (_prev){
+			lastNodeGot = _prev;
+			lastIndexGot = base - _prev->count;
+		} else {
+			lastNodeGot = root;
+			lastIndexGot = 0;
+		}
+		return;
+	}
+
+	// keep nodes at least half full, pull objects from the next node if those fit
+	node_t *_next = node->next;
+	if (_next && node->count < N / 2 && node->count + _next->count <= N){
+		T *src = _next->items();
+		for (unsigned i = 0; i != _next->count; ++i){
+			new (it + node->count + i) T(std::move(src[i]));
+			src[i].~T();
+		}
+		node->count += _next->count;
+		node->next = _next->next;
+		if (last == _next)
+			last = node;
+
+		_freeNode(_next);
+	}
+
+	lastNodeGot = node;
+	lastIndexGot = base;
+}
+
+template<typename T, unsigned N, class Alloc>
+template<class... Args>
+bool UnrolledLinkedList<T, N, Alloc>::emplace(unsigned index, Args&&... args){
+	if(index >= _size)
+		return emplace_back(std::forward<Args>(args)...);
+
+	unsigned base;
+	node_t *node = getNode(index, base);
+	return _insert(node, base, index - base, std::forward<Args>(args)...);
+}
+
+template<typename T, unsigned N, class Alloc>
+template<class... Args>
+bool UnrolledLinkedList<T, N, Alloc>::emplace_back(Args&&... args){
+	if (last && last->count != N){
+		new (last->items() + last->count) T(std::forward<Args>(args)...);
+		++last->count;
+		++_size;
+		return true;
+	}
+
+	// start a new node instead of splitting the last one, so that sequential adds fill nodes up
+	node_t *node = _newNode();
+	if (!node)
+		return false;
+
+	new (node->items()) T(std::forward<Args>(args)...);
+	node->count = 1;
+
+	if (last)
+		last->next = node;
+	else
+		root = node;
+
+	last = node;
+	++_size;
+	return true;
+}
+
+template<typename T, unsigned N, class Alloc>
+template<class... Args>
+bool UnrolledLinkedList<T, N, Alloc>::emplace_front(Args&&... args){
+	if(!_size)
+		return emplace_back(std::forward<Args>(args)...);
+
+	return _insert(root, 0, 0, std::forward<Args>(args)...);
+}
+
+template<typename T, unsigned N, class Alloc>
+bool UnrolledLinkedList<T, N, Alloc>::set(unsigned index, const T& _t){
+	if(index >= _size)
+		return false;
+
+	(*this)[index] = _t;
+	return true;
+}
+
+template<typename T, unsigned N, class Alloc>
+bool UnrolledLinkedList<T, N, Alloc>::set(unsigned index, T&& _t){
+	if(index >= _size)
+		return false;
+
+	(*this)[index] = std::move(_t);
+	return true;
+}
+
+template<typename T, unsigned N, class Alloc>
+T UnrolledLinkedList<T, N, Alloc>::remove(unsigned index){
+	unsigned base;
+	node_t *node = getNode(index, base);
+	if (!node)
+		return T();
+
+	T ret(std::move(node->items()[index - base]));
+	_erase(node, base, index - base);
+	return ret;
+}
+
+template<typename T, unsigned N, class Alloc>
+void UnrolledLinkedList<T, N, Alloc>::unlink(unsigned index){
+	unsigned base;
+	node_t *node = getNode(index, base);
+	if (node)
+		_erase(node, base, index - base);
+}
+
+template<typename T, unsigned N, class Alloc>
+T UnrolledLinkedList<T, N, Alloc>::pop(){
+	if(!_size)
+		return T();
+
+	return remove(_size - 1);
+}
+
+template<typename T, unsigned N, class Alloc>
+T UnrolledLinkedList<T, N, Alloc>::shift(){
+	if(!_size)
+		return T();
+
+	T ret(std::move(root->items()[0]));
+	_erase(root, 0, 0);
+	return ret;
+}
+
+template<typename T, unsigned N, class Alloc>
+T UnrolledLinkedList<T, N, Alloc>::get(unsigned index) const {
+	unsigned base;
+	node_t *node = getNode(index, base);
+
+	return (node ? node->items()[index - base] : T());
+}
+
+template<typename T, unsigned N, class Alloc>
+void UnrolledLinkedList<T, N, Alloc>::clear(){
+	while (root){
+		node_t *_next = root->next;
+		T *it = root->items();
+		for (unsigned i = 0; i != root->count; ++i)
+			it[i].~T();
+
+		_freeNode(root);
+		root = _next;
+	}
+
+	last = lastNodeGot = nullptr;
+	_size = lastIndexGot = 0;
+}
+
+template<typename T, unsigned N, class Alloc>
+template<class Less>
+unsigned* UnrolledLinkedList<T, N, Alloc>::_sortIndex(unsigned *idx, unsigned *tmp, unsigned n, T **addr, Less &less){
+	for (unsigned width = 1; width < n; width *= 2){
+		for (unsigned lo = 0; lo < n; lo += 2 * width){
+			unsigned mid = lo + width < n ? lo + width : n;
+			unsigned hi = lo + 2 * width < n ? lo + 2 * width : n;
+			unsigned a = lo, b = mid, k = lo;
+
+			while (a < mid && b < hi)
+				tmp[k++] = less(*addr[idx[b]], *addr[idx[a]]) ? idx[b++] : idx[a++];
+			while (a < mid)
+				tmp[k++] = idx[a++];
+			while (b < hi)
+				tmp[k++] = idx[b++];
+		}
+
+		unsigned *swp = idx;
+		idx = tmp;
+		tmp = swp;
+	}
+
+	return idx;
+}
+
+template<typename T, unsigned N, class Alloc>
+void UnrolledLinkedList<T, N, Alloc>::sort(int (*cmp)(T &, T &)){
+	_sort(llist::make_less<T>(cmp));
+}
+
+template<typename T, unsigned N, class Alloc>
+template<class Compare>
+void UnrolledLinkedList<T, N, Alloc>::sort(Compare &&cmp){
+	_sort(llist::make_less<T>(cmp));
+}
+
+template<typename T, unsigned N, class Alloc>
+template<class Less>
+void UnrolledLinkedList<T, N, Alloc>::_sort(Less &&less){
+	if(_size < 2) return; // trivial case;
+
+	T **addr = new (std::nothrow) T*[_size];
+	unsigned *idx = new (std::nothrow) unsigned[2 * _size];
+
+	if (!addr || !idx){
+		delete[] addr;
+		delete[] idx;
+
+		// no memory for index, do stable in-place bubble sort
+		bool swapped = true;
+		while (swapped){
+			swapped = false;
+			for (Iterator a = begin(), b = begin(); ++b != end(); ++a){
+				if (less(*b, *a)){
+					T obj(std::move(*a));
+					*a = std::move(*b);
+					*b = std::move(obj);
+					swapped = true;
+				}
+			}
+		}
+		return;
+	}
+
+	unsigned n = 0;
+	for (node_t *node = root; node; node = node->next){
+		for (unsigned i = 0; i != node->count; ++i){
+			addr[n] = node->items() + i;
+			idx[n] = n;
+			++n;
+		}
+	}
+
+	// perm[i] - original position of the object that must go to position i
+	unsigned *perm = _sortIndex(idx, idx + n, n, addr, less);
+
+	// move objects in place following permutation cycles
+	for (unsigned i = 0; i != n; ++i){
+		if (perm[i] == i)
+			continue;
+
+		T obj(std::move(*addr[i]));
+		unsigned j = i;
+		while (perm[j] != i){
+			unsigned k = perm[j];
+			*addr[j] = std::move(*addr[k]);
+			perm[j] = j;
+			j = k;
+		}
+		*addr[j] = std::move(obj);
+		perm[j] = j;
+	}
+
+	delete[] addr;
+	delete[] idx;
+}
+
+template<typename T, unsigned N, class Alloc>
+UnrolledLinkedList<T, N, Alloc>& UnrolledLinkedList<T, N, Alloc>::operator =(const UnrolledLinkedList& rhs) {
+	if (this == &rhs)
+		return *this;
+
+	clear();
+	for (const auto& i : rhs)
+		add(i);
+
+	return *this;
+}
+
+template<typename T, unsigned N, class Alloc>
+UnrolledLinkedList<T, N, Alloc>& UnrolledLinkedList<T, N, Alloc>::operator =(UnrolledLinkedList&& rhs) {
+	if (this == &rhs)
+		return *this;
+
+	clear();
+
+	if (!Alloc::is_always_equal){
+		// nodes must stay with rhs's allocator, move objects one by one,
+		// ones which could not be moved for lack of nodes stay in rhs
+		while (rhs._size){
+			if (!emplace_back(std::move(rhs.root->items()[0])))
+				break;
+			rhs.unlink(0);
+		}
+		return *this;
+	}
+
+	root = rhs.root;
+	last = rhs.last;
+	_size = rhs._size;
+	lastNodeGot = rhs.lastNodeGot;
+	lastIndexGot = rhs.lastIndexGot;
+
+	rhs.root = rhs.last = rhs.lastNodeGot = nullptr;
+	rhs._size = rhs.lastIndexGot = 0;
+
+	return *this;
+}
@@ -0,0 +1,77 @@
+//g++ -O2 -std=c++14 -pthread concurrent_bench.cpp -o concurrent_bench && ./concurrent_bench
+
+/*
+	ConcurrentLinkedList reader scaling benchmark
+
+	Each reader thread scans the whole list sequentially by index, with it's own cursor.
+	Compared against LinkedList guarded by a plain std::mutex,
+	where readers are serialized and share the single node cache
+*/
+
+#include "../../ConcurrentLinkedList.h"
+#include <atomic>
+#include <chrono>
+#include <iostream>
+#include <thread>
+#include <vector>
+
+static const unsigned list_size = 10000;
+static const unsigned scans = 200;
+
+struct MutexList {
+	LinkedList<unsigned> list;
+	mutable std::mutex mtx;
+	unsigned get(unsigned i) const { std::lock_guard<std::mutex> lock(mtx); return list.get(i); }
+};
+
+template<class Reader>
+double run(unsigned threads, Reader read){
+	std::atomic<unsigned long> checksum(0);
+	std::vector<std::thread> pool;
+
+	auto t1 = std::chrono::steady_clock::now();
+	for (unsigned t = 0; t != threads; ++t){
+		pool.emplace_back([&](){
+			unsigned long sum = 0;
+			read(sum);
+			checksum += sum;
+		});
+	}
+	for (auto& t : pool)
+		t.join();
+	auto t2 = std::chrono::steady_clock::now();
+
+	// every thread must see the same data
+	if (checksum != (unsigned long)threads * scans * (list_size - 1) * list_size / 2)
+		std::cerr << "checksum mismatch!" << std::endl;
+
+	double ms = std::chrono::duration<double, std::milli>(t2 - t1).count();
+	return (double)threads * scans * list_size / ms / 1000;	// Mreads/s
+}
+
+int main(){
+	ConcurrentLinkedList<unsigned> clist;
+	MutexList mlist;
+	for (unsigned i = 0; i != list_size; ++i){
+		clist.add(i);
+		mlist.list.add(i);
+	}
+
+	std::cout << "hardware threads: " << std::thread::hardware_concurrency() << std::endl;
+	std::cout << "readers, ConcurrentLinkedList Mreads/s, mutex+LinkedList Mreads/s" << std::endl;
+	for (unsigned threads = 1; threads <= 8; threads *= 2){
+		double shared = run(threads, [&clist](unsigned long &sum){
+			ConcurrentLinkedList<unsigned>::ReadCursor cursor;
+			for (unsigned s = 0; s != scans; ++s)
+				for (unsigned i = 0; i != list_size; ++i)
+					sum += clist.get(i, cursor);
+		});
+		// readers are serialized here and thrash the single node cache of the list
+		double exclusive = run(threads, [&mlist](unsigned long &sum){
+			for (unsigned s = 0; s != scans; ++s)
+				for (unsigned i = 0; i != list_size; ++i)
+					sum += mlist.get(i);
+		});
+		std::cout << threads << ", " << shared << ", " << exclusive << std::endl;
+	}
+}
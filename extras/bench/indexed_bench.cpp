@@ -0,0 +1,49 @@
+//g++ -O2 -std=c++14 indexed_bench.cpp -o indexed_bench && ./indexed_bench
+
+/*
+	Random index access: LinkedList node cache walk vs IndexedLinkedList skip list
+
+	get(), set(), add(index) and remove(index) at random positions
+	for lists of several thousand elements
+*/
+
+#include "../../LinkedList.h"
+#include "../../IndexedLinkedList.h"
+#include <chrono>
+#include <iostream>
+#include <random>
+
+static const unsigned ops = 20000;
+
+template<class List>
+double bench(unsigned list_size, unsigned long &checksum){
+	List list;
+	for (unsigned i = 0; i != list_size; ++i)
+		list.add(i);
+
+	std::mt19937 rng(42);
+	auto t1 = std::chrono::steady_clock::now();
+	for (unsigned i = 0; i != ops; ++i){
+		unsigned idx = rng() % list.size();
+		switch (i & 3){
+		case 0: checksum += list.get(idx); break;
+		case 1: list.set(idx, i); break;
+		case 2: list.add(idx, i); break;
+		case 3: checksum += list.remove(idx); break;
+		}
+	}
+	auto t2 = std::chrono::steady_clock::now();
+
+	return std::chrono::duration<double, std::nano>(t2 - t1).count() / ops;
+}
+
+int main(){
+	unsigned long checksum = 0;
+	std::cout << "elements, LinkedList ns/op, IndexedLinkedList ns/op" << std::endl;
+	for (unsigned n = 1000; n <= 16000; n *= 2){
+		double linear = bench< LinkedList<unsigned> >(n, checksum);
+		double indexed = bench< IndexedLinkedList<unsigned> >(n, checksum);
+		std::cout << n << ", " << linear << ", " << indexed << std::endl;
+	}
+	std::cout << "checksum: " << checksum << std::endl;
+}
@@ -0,0 +1,339 @@
+//g++ -O2 -std=c++14 list_bench.cpp -o list_bench && ./list_bench [--json] [-n size]
+
+/*
+	LinkedList throughput under typical workloads compared to RingBufferList,
+	std::list, std::forward_list and std::deque
+
+	fifo			- add() to the end, shift() from the start, list size is steady
+	lifo			- unshift()/shift() at the start, the way a singly linked list is used as a stack
+	seq_get			- get(i) for i = 0..size-1 (std containers are iterated instead)
+	random_get		- get() at random indexes
+	insert_remove	- add(index)/remove(index) at random indexes
+	sort_*			- sort() of random, sorted and reverse sorted input
+	copy, clear		- copy of a large list and clear() of it
+
+	Every workload is run several times and the best time is taken, result is ns per operation
+	(per element for sort, copy and clear). Output is CSV, or JSON with --json, to track it over time
+*/
+
+#include "../../LinkedList.h"
+#include "../../RingBufferList.h"
+#include <algorithm>
+#include <chrono>
+#include <deque>
+#include <forward_list>
+#include <iostream>
+#include <iterator>
+#include <list>
+#include <random>
+#include <string.h>
+#include <stdlib.h>
+#include <string>
+#include <vector>
+
+static const unsigned rounds = 5;
+
+/*
+	Containers behind the same interface, each method does what is idiomatic for the container
+*/
+struct LinkedListAdapter {
+	static const char* name(){ return "LinkedList"; }
+	LinkedList<unsigned> c;
+
+	void push_back(unsigned v){ c.add(v); }
+	void push_front(unsigned v){ c.unshift(v); }
+	unsigned pop_front(){ return c.shift(); }
+	unsigned get(unsigned i){ return c.get(i); }
+	unsigned sum(){ unsigned s = 0; for (unsigned i = 0; i != c.size(); ++i) s += c.get(i); return s; }
+	void insert(unsigned i, unsigned v){ c.add(i, v); }
+	unsigned erase(unsigned i){ return c.remove(i); }
+	void sort(){ c.sort(); }
+	void clear(){ c.clear(); }
+	unsigned size() const { return c.size(); }
+};
+
+struct RingBufferListAdapter {
+	static const char* name(){ return "RingBufferList"; }
+	RingBufferList<unsigned> c;
+
+	void push_back(unsigned v){ c.add(v); }
+	void push_front(unsigned v){ c.unshift(v); }
+	unsigned pop_front(){ return c.shift(); }
+	unsigned get(unsigned i){ return c.get(i); }
+	unsigned sum(){ unsigned s = 0; for (unsigned v : c) s += v; return s; }
+	void insert(unsigned i, unsigned v){ c.add(i, v); }
+	unsigned erase(unsigned i){ return c.remove(i); }
+	void sort(){ c.sort(); }
+	void clear(){ c.clear(); }
+	unsigned size() const { return c.size(); }
+};
+
+struct StdListAdapter {
+	static const char* name(){ return "std::list"; }
+	std::list<unsigned> c;
+
+	void push_back(unsigned v){ c.push_back(v); }
+	void push_front(unsigned v){ c.push_front(v); }
+	unsigned pop_front(){ unsigned v = c.front(); c.pop_front(); return v; }
+	unsigned get(unsigned i){ return *std::next(c.begin(), i); }
+	unsigned sum(){ unsigned s = 0; for (unsigned v : c) s += v; return s; }
+	void insert(unsigned i, unsigned v){ c.insert(std::next(c.begin(), i), v); }
+	unsigned erase(unsigned i){ auto it = std::next(c.begin(), i); unsigned v = *it; c.erase(it); return v; }
+	void sort(){ c.sort(); }
+	void clear(){ c.clear(); }
+	unsigned size() const { return c.size(); }
+};
+
+// forward_list has no size and no push_back, tail is kept aside and found again after edits in the middle
+struct StdForwardListAdapter {
+	static const char* name(){ return "std::forward_list"; }
+	std::forward_list<unsigned> c;
+	std::forward_list<unsigned>::iterator tail = c.before_begin();
+	unsigned n = 0;
+	bool tailValid = true;
+
+	StdForwardListAdapter(){}
+	StdForwardListAdapter(const StdForwardListAdapter &rhs) : c(rhs.c), n(rhs.n), tailValid(false) {}
+
+	void push_back(unsigned v){
+		if (!tailValid){
+			tail = c.before_begin();
+			for (auto i = c.begin(); i != c.end(); ++i)
+				tail = i;
+			tailValid = true;
+		}
+		tail = c.insert_after(tail, v);
+		++n;
+	}
+	void push_front(unsigned v){ c.push_front(v); if (!n++) tail = c.begin(); }
+	unsigned pop_front(){ unsigned v = c.front(); c.pop_front(); if (!--n) tail = c.before_begin(); return v; }
+	unsigned get(unsigned i){ return *std::next(c.begin(), i); }
+	unsigned sum(){ unsigned s = 0; for (unsigned v : c) s += v; return s; }
+	void insert(unsigned i, unsigned v){ c.insert_after(std::next(c.before_begin(), i), v); ++n; tailValid = false; }
+	unsigned erase(unsigned i){ auto it = std::next(c.before_begin(), i); unsigned v = *std::next(it); c.erase_after(it); --n; tailValid = false; return v; }
+	void sort(){ c.sort(); tailValid = false; }
+	void clear(){ c.clear(); n = 0; tail = c.before_begin(); tailValid = true; }
+	unsigned size() const { return n; }
+};
+
+struct StdDequeAdapter {
+	static const char* name(){ return "std::deque"; }
+	std::deque<unsigned> c;
+
+	void push_back(unsigned v){ c.push_back(v); }
+	void push_front(unsigned v){ c.push_front(v); }
+	unsigned pop_front(){ unsigned v = c.front(); c.pop_front(); return v; }
+	unsigned get(unsigned i){ return c[i]; }
+	unsigned sum(){ unsigned s = 0; for (unsigned v : c) s += v; return s; }
+	void insert(unsigned i, unsigned v){ c.insert(c.begin() + i, v); }
+	unsigned erase(unsigned i){ unsigned v = c[i]; c.erase(c.begin() + i); return v; }
+	void sort(){ std::stable_sort(c.begin(), c.end()); }
+	void clear(){ c.clear(); }
+	unsigned size() const { return c.size(); }
+};
+
+/*
+	Workloads, each returns elapsed ns and the number of operations done
+*/
+typedef std::chrono::steady_clock bench_clock;
+
+static double elapsed(bench_clock::time_point t1, bench_clock::time_point t2){
+	return std::chrono::duration<double, std::nano>(t2 - t1).count();
+}
+
+static unsigned long checksum = 0;
+
+template<class C>
+void fill(C &c, unsigned n){
+	for (unsigned i = 0; i != n; ++i)
+		c.push_back(i);
+}
+
+template<class C>
+double fifo(unsigned n, unsigned &ops){
+	C c;
+	fill(c, n);
+	auto t1 = bench_clock::now();
+	for (unsigned i = 0; i != n; ++i){
+		c.push_back(i);
+		checksum += c.pop_front();
+	}
+	ops = n;
+	return elapsed(t1, bench_clock::now());
+}
+
+template<class C>
+double lifo(unsigned n, unsigned &ops){
+	C c;
+	fill(c, n);
+	auto t1 = bench_clock::now();
+	for (unsigned i = 0; i != n; ++i)
+		c.push_front(i);
+	for (unsigned i = 0; i != n; ++i)
+		checksum += c.pop_front();
+	ops = n * 2;
+	return elapsed(t1, bench_clock::now());
+}
+
+template<class C>
+double seq_get(unsigned n, unsigned &ops){
+	C c;
+	fill(c, n);
+	auto t1 = bench_clock::now();
+	checksum += c.sum();
+	ops = n;
+	return elapsed(t1, bench_clock::now());
+}
+
+template<class C>
+double random_get(unsigned n, unsigned &ops){
+	C c;
+	fill(c, n);
+	std::mt19937 rng(42);
+	std::vector<unsigned> idx(n);
+	for (unsigned &i : idx)
+		i = rng() % n;
+
+	auto t1 = bench_clock::now();
+	for (unsigned i : idx)
+		checksum += c.get(i);
+	ops = n;
+	return elapsed(t1, bench_clock::now());
+}
+
+template<class C>
+double insert_remove(unsigned n, unsigned &ops){
+	C c;
+	fill(c, n);
+	std::mt19937 rng(42);
+	std::vector<unsigned> idx(n);
+	for (unsigned k = 0; k != n; ++k)
+		idx[k] = rng() % (n + 1);
+
+	auto t1 = bench_clock::now();
+	for (unsigned k = 0; k != n; ++k)
+		c.insert(idx[k], k);
+	for (unsigned k = 0; k != n; ++k)
+		checksum += c.erase(idx[k] % c.size());
+	ops = n * 2;
+	return elapsed(t1, bench_clock::now());
+}
+
+template<class C, int kind>
+double sort(unsigned n, unsigned &ops){
+	C c;
+	std::mt19937 rng(42);
+	for (unsigned i = 0; i != n; ++i)
+		c.push_back(kind == 0 ? rng() : kind == 1 ? i : n - i);
+
+	auto t1 = bench_clock::now();
+	c.sort();
+	auto t2 = bench_clock::now();
+	checksum += c.pop_front();
+	ops = n;
+	return elapsed(t1, t2);
+}
+
+template<class C>
+double copy(unsigned n, unsigned &ops){
+	C c;
+	fill(c, n);
+	auto t1 = bench_clock::now();
+	C copy(c);
+	auto t2 = bench_clock::now();
+	checksum += copy.size();
+	ops = n;
+	return elapsed(t1, t2);
+}
+
+template<class C>
+double clear(unsigned n, unsigned &ops){
+	C c;
+	fill(c, n);
+	auto t1 = bench_clock::now();
+	c.clear();
+	auto t2 = bench_clock::now();
+	checksum += c.size();
+	ops = n;
+	return elapsed(t1, t2);
+}
+
+/*
+	Results output
+*/
+struct Result {
+	std::string workload;
+	const char *container;
+	unsigned size;
+	double ns_per_op;
+};
+
+static std::vector<Result> results;
+
+template<class C>
+void run(const char *workload, double (*fn)(unsigned, unsigned&), unsigned n){
+	double best = 0;
+	for (unsigned r = 0; r != rounds; ++r){
+		unsigned ops = 1;
+		double ns = fn(n, ops) / ops;
+		if (!r || ns < best)
+			best = ns;
+	}
+	results.push_back(Result{workload, C::name(), n, best});
+}
+
+template<class C>
+void run_all(unsigned n){
+	// workloads with O(size) per operation in lists run on smaller lists
+	unsigned small = n / 5 ? n / 5 : 1;
+
+	run<C>("fifo", fifo<C>, n);
+	run<C>("lifo", lifo<C>, n);
+	run<C>("seq_get", seq_get<C>, n);
+	run<C>("random_get", random_get<C>, small);
+	run<C>("insert_remove", insert_remove<C>, small);
+	run<C>("sort_random", sort<C, 0>, n);
+	run<C>("sort_sorted", sort<C, 1>, n);
+	run<C>("sort_reverse", sort<C, 2>, n);
+	run<C>("copy", copy<C>, n);
+	run<C>("clear", clear<C>, n);
+}
+
+int main(int argc, char **argv){
+	bool json = false;
+	unsigned n = 10000;
+	for (int i = 1; i < argc; ++i){
+		if (!strcmp(argv[i], "--json"))
+			json = true;
+		else if (!strcmp(argv[i], "-n") && i + 1 < argc)
+			n = strtoul(argv[++i], nullptr, 10);
+		else {
+			std::cerr << "usage: " << argv[0] << " [--json] [-n size]" << std::endl;
+			return 1;
+		}
+	}
+	if (!n)
+		n = 1;
+
+	run_all<LinkedListAdapter>(n);
+	run_all<RingBufferListAdapter>(n);
+	run_all<StdListAdapter>(n);
+	run_all<StdForwardListAdapter>(n);
+	run_all<StdDequeAdapter>(n);
+
+	if (json){
+		std::cout << "{\"benchmarks\": [" << std::endl;
+		for (size_t i = 0; i != results.size(); ++i){
+			const Result &r = results[i];
+			std::cout << "  {\"workload\": \"" << r.workload << "\", \"container\": \"" << r.container
+				<< "\", \"size\": " << r.size << ", \"ns_per_op\": " << r.ns_per_op << "}"
+				<< (i + 1 != results.size() ? "," : "") << std::endl;
+		}
+		std::cout << "], \"checksum\": " << checksum << "}" << std::endl;
+	} else {
+		std::cout << "workload,container,size,ns_per_op" << std::endl;
+		for (const Result &r : results)
+			std::cout << r.workload << "," << r.container << "," << r.size << "," << r.ns_per_op << std::endl;
+		std::cerr << "checksum: " << checksum << std::endl;
+	}
+}
@@ -0,0 +1,54 @@
+//g++ -O2 -std=c++14 pool_bench.cpp -o pool_bench && ./pool_bench
+
+/*
+	Heap-backed vs pool-backed vs node caching LinkedList node churn benchmark
+
+	Simulates a FIFO queue oscillating around a constant depth:
+	each round pushes a burst of elements and drains it back to the base depth
+*/
+
+#include "../../LinkedList.h"
+#include <chrono>
+#include <iostream>
+
+static const unsigned base_depth = 64;
+static const unsigned burst = 64;
+static const unsigned rounds = 200000;
+
+template<class List>
+double churn(List &list, unsigned long &checksum){
+	for (unsigned i = 0; i != base_depth; ++i)
+		list.add(i);
+
+	auto t1 = std::chrono::steady_clock::now();
+	for (unsigned r = 0; r != rounds; ++r){
+		for (unsigned i = 0; i != burst; ++i)
+			list.add(r + i);
+		for (unsigned i = 0; i != burst; ++i)
+			checksum += list.shift();
+	}
+	auto t2 = std::chrono::steady_clock::now();
+
+	return std::chrono::duration<double, std::milli>(t2 - t1).count();
+}
+
+int main(){
+	unsigned long checksum = 0;
+
+	LinkedList<unsigned> heap;
+	double heap_ms = churn(heap, checksum);
+
+	// keep large pool in static storage
+	static PooledLinkedList<unsigned, base_depth + burst> pooled;
+	double pool_ms = churn(pooled, checksum);
+
+	CachedLinkedList<unsigned> cached;
+	double cache_ms = churn(cached, checksum);
+
+	const double ops = 2.0 * rounds * burst;
+	std::cout << "FIFO churn, depth " << base_depth << "+" << burst << ", " << ops << " ops" << std::endl;
+	std::cout << "heap allocator: " << heap_ms << " ms, " << heap_ms * 1e6 / ops << " ns/op" << std::endl;
+	std::cout << "node pool:      " << pool_ms << " ms, " << pool_ms * 1e6 / ops << " ns/op" << std::endl;
+	std::cout << "node cache:     " << cache_ms << " ms, " << cache_ms * 1e6 / ops << " ns/op" << std::endl;
+	std::cout << "checksum: " << checksum << std::endl;
+}
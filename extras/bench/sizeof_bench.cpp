@@ -0,0 +1,39 @@
+//g++ -O2 -std=c++14 sizeof_bench.cpp -o sizeof_bench && ./sizeof_bench
+
+/*
+	Memory footprint of list types: empty list object, per-node cost
+	and total for many small lists of small objects
+	build with -m32 to see the numbers closer to 32-bit MCUs
+*/
+
+#include "../../LinkedList.h"
+#include "../../DLinkedList.h"
+#include "../../CompactLinkedList.h"
+#include "../../StaticLinkedList.h"
+#include <iostream>
+#include <stdint.h>
+
+static const unsigned lists = 1000;
+static const unsigned items = 4;
+
+// prints: name, list object size, per-node size, total for 'lists' lists of 'items' objects
+void report(const char *name, size_t list, size_t node, bool inline_nodes = false){
+	size_t total = inline_nodes ? lists * list : lists * (list + items * node);
+	std::cout << name << ", " << list << ", " << node << ", " << total << std::endl;
+}
+
+int main(){
+	std::cout << "pointer size: " << sizeof(void*) << ", " << lists << " lists of " << items << " uint8_t" << std::endl;
+	std::cout << "type, sizeof(list), bytes per node, total bytes" << std::endl;
+
+	report("LinkedList", sizeof(LinkedList<uint8_t>), sizeof(ListNode<uint8_t>));
+	report("DLinkedList", sizeof(DLinkedList<uint8_t>), sizeof(DListNode<uint8_t>));
+	report("CompactLinkedList<uint16_t>", sizeof(CompactLinkedList<uint8_t>), sizeof(ListNode<uint8_t>));
+	report("CompactLinkedList<uint8_t>", sizeof(CompactLinkedList<uint8_t, uint8_t>), sizeof(ListNode<uint8_t>));
+	// nodes are inside of the list object
+	report("StaticLinkedList<4>", sizeof(StaticLinkedList<uint8_t, items>), sizeof(StaticLinkedList<uint8_t, items>::index_t) + sizeof(uint8_t), true);
+	report("PooledLinkedList<4>", sizeof(PooledLinkedList<uint8_t, items>), sizeof(ListNode<uint8_t>), true);
+
+	// heap allocated nodes also pay allocator's header and rounding
+	std::cout << "note: heap nodes also cost allocator's block header, usually " << 2 * sizeof(void*) << "+ bytes each" << std::endl;
+}
@@ -0,0 +1,98 @@
+//g++ -O2 -std=c++14 slab_bench.cpp -o slab_bench && ./slab_bench [size]
+
+/*
+	Heap-backed vs slab-backed LinkedList traversal and copy benchmark
+
+	Lists are built by add() interleaved with other heap allocations of random size,
+	half of which are released afterwards, the way a long-living list grows next to other objects.
+	Heap nodes end up scattered between those blocks, slab nodes stay together.
+	Then each list is copied and both original and copy are walked with an iterator
+*/
+
+#include "../../LinkedList.h"
+#include <chrono>
+#include <iostream>
+#include <random>
+#include <stdlib.h>
+#include <vector>
+
+static const unsigned rounds = 5;
+
+typedef std::chrono::steady_clock bench_clock;
+
+static double elapsed(bench_clock::time_point t1, bench_clock::time_point t2){
+	return std::chrono::duration<double, std::nano>(t2 - t1).count();
+}
+
+template<class List>
+void build(List &list, unsigned n, std::vector<void*> &garbage){
+	std::mt19937 rng(42);
+	for (unsigned i = 0; i != n; ++i){
+		list.add(i);
+		garbage.push_back(malloc(16 + rng() % 112));
+	}
+	for (size_t i = 0; i < garbage.size(); i += 2){
+		free(garbage[i]);
+		garbage[i] = nullptr;
+	}
+}
+
+// best ns per node of a walk over the list
+template<class List>
+double walk(const List &list, unsigned long &checksum){
+	double best = 0;
+	for (unsigned r = 0; r != rounds; ++r){
+		auto t1 = bench_clock::now();
+		unsigned long sum = 0;
+		for (auto i = list.cbegin(); i != list.cend(); ++i)
+			sum += *i;
+		double ns = elapsed(t1, bench_clock::now()) / list.size();
+		checksum += sum;
+		if (!r || ns < best)
+			best = ns;
+	}
+	return best;
+}
+
+// best ns per node of a copy of the list
+template<class List>
+double copy(const List &list, unsigned long &checksum){
+	double best = 0;
+	for (unsigned r = 0; r != rounds; ++r){
+		auto t1 = bench_clock::now();
+		List c(list);
+		double ns = elapsed(t1, bench_clock::now()) / list.size();
+		checksum += c.size();
+		if (!r || ns < best)
+			best = ns;
+	}
+	return best;
+}
+
+template<class List>
+void run(const char *name, unsigned n, unsigned long &checksum){
+	std::vector<void*> garbage;
+	List list;
+	build(list, n, garbage);
+	List c(list);
+
+	std::cout << name << "\t" << walk(list, checksum) << "\t\t" << copy(list, checksum)
+		<< "\t\t" << walk(c, checksum) << std::endl;
+
+	for (void *p : garbage)
+		free(p);
+}
+
+int main(int argc, char **argv){
+	unsigned n = argc > 1 ? strtoul(argv[1], nullptr, 10) : 200000;
+	if (!n)
+		n = 1;
+	unsigned long checksum = 0;
+
+	std::cout << "list of " << n << " nodes, ns per node" << std::endl;
+	std::cout << "allocator\twalk\t\tcopy\t\twalk copy" << std::endl;
+	run< LinkedList<unsigned> >("heap", n, checksum);
+	run< SlabLinkedList<unsigned> >("slab", n, checksum);
+
+	std::cerr << "checksum: " << checksum << std::endl;
+}
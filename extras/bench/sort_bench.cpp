@@ -0,0 +1,162 @@
+//g++ -O2 -std=c++14 sort_bench.cpp -o sort_bench && ./sort_bench
+
+/*
+	LinkedList::sort() on random, sorted, reverse and nearly-sorted input
+
+	compares bottom-up merge sort with inlined comparator and with a function pointer,
+	previous natural merge sort (kept here for reference) and std::list::sort()
+
+	Keeping a list ordered while adding batches of objects:
+	add() + sort() after each batch vs insert_sorted() vs merge() of a sorted batch
+*/
+
+#include "../../LinkedList.h"
+#include <chrono>
+#include <iostream>
+#include <list>
+#include <random>
+#include <vector>
+
+static const unsigned list_size = 10000;
+static const unsigned rounds = 20;
+
+int cmp_int(int &a, int &b){ return a < b ? -1 : a > b; }
+
+// previous algorithm, repeatedly merges adjacent natural runs until one run is left
+template<class Node>
+Node* natural_sort(Node *&root, int (*cmp)(int &, int &)){
+	for(;;) {
+		Node **joinPoint = &root;
+		while(*joinPoint) {
+			Node *a = *joinPoint;
+			Node *a_end = a;
+			while(a_end->next && cmp(a_end->data, a_end->next->data) <= 0) a_end = a_end->next;
+			if(!a_end->next) {
+				if(joinPoint == &root)
+					return a_end;
+				break;
+			}
+
+			Node *b = a_end->next;
+			Node *b_end = b;
+			while(b_end->next && cmp(b_end->data, b_end->next->data) <= 0) b_end = b_end->next;
+			Node *tail = b_end->next;
+			a_end->next = NULL;
+			b_end->next = NULL;
+
+			while(a && b) {
+				if(cmp(a->data, b->data) <= 0) { *joinPoint = a; joinPoint = &a->next; a = a->next; }
+				else { *joinPoint = b; joinPoint = &b->next; b = b->next; }
+			}
+			Node *rest = a ? a : b;
+			*joinPoint = rest;
+			while(rest->next) rest = rest->next;
+			rest->next = tail;
+			joinPoint = &rest->next;
+		}
+	}
+}
+
+class SortList : public LinkedList<int> {
+public:
+	void push_back(int v){ add(v); }
+};
+
+// bare chain of list nodes to run the reference algorithm on
+class NaturalList {
+	ListNode<int> *root = nullptr;
+	ListNode<int> *last = nullptr;
+
+public:
+	~NaturalList(){ while (root){ ListNode<int> *next = root->next; delete root; root = next; } }
+	void push_back(int v){ ListNode<int> *node = new ListNode<int>(v); if (last) last->next = node; else root = node; last = node; }
+	int front() const { return root->data; }
+	int back() const { return last->data; }
+	void natural_sort(){ last = ::natural_sort(root, cmp_int); }
+};
+
+std::vector<int> make_input(int kind){
+	std::mt19937 rng(42);
+	std::vector<int> v(list_size);
+	for (unsigned i = 0; i != list_size; ++i){
+		switch (kind){
+		case 0: v[i] = rng(); break;
+		case 1: v[i] = i; break;
+		case 2: v[i] = list_size - i; break;
+		// every 20th element is out of place
+		case 3: v[i] = i % 20 ? i : rng() % list_size; break;
+		}
+	}
+	return v;
+}
+
+template<class List, class Sort>
+double bench(const std::vector<int> &input, Sort sort, long &checksum){
+	double total = 0;
+	for (unsigned r = 0; r != rounds; ++r){
+		List list;
+		for (int i : input)
+			list.push_back(i);
+
+		auto t1 = std::chrono::steady_clock::now();
+		sort(list);
+		auto t2 = std::chrono::steady_clock::now();
+		total += std::chrono::duration<double, std::micro>(t2 - t1).count();
+		checksum += list.front() - list.back();
+	}
+	return total / rounds;
+}
+
+static const unsigned batch_size = 100;
+
+template<class Add>
+double bench_batches(Add add, long &checksum){
+	std::mt19937 rng(42);
+	LinkedListCore<int> list;
+	auto t1 = std::chrono::steady_clock::now();
+	for (unsigned b = 0; b != list_size / batch_size; ++b){
+		std::vector<int> batch(batch_size);
+		for (int &i : batch)
+			i = rng() % list_size;
+		add(list, batch);
+	}
+	auto t2 = std::chrono::steady_clock::now();
+	checksum += list.front() - list.back();
+	return std::chrono::duration<double, std::micro>(t2 - t1).count();
+}
+
+int main(){
+	const char *kinds[] = {"random", "sorted", "reverse", "nearly sorted"};
+	long checksum = 0;
+
+	std::cout << list_size << " elements, us per sort" << std::endl;
+	std::cout << "input, sort(lambda), sort(cmp_int), natural merge (old), std::list::sort" << std::endl;
+	for (int kind = 0; kind != 4; ++kind){
+		std::vector<int> input = make_input(kind);
+		double lambda = bench<SortList>(input, [](SortList &l){ l.sort([](int a, int b){ return a < b; }); }, checksum);
+		double fptr = bench<SortList>(input, [](SortList &l){ l.sort(cmp_int); }, checksum);
+		double natural = bench<NaturalList>(input, [](NaturalList &l){ l.natural_sort(); }, checksum);
+		double stdlist = bench< std::list<int> >(input, [](std::list<int> &l){ l.sort(); }, checksum);
+		std::cout << kinds[kind] << ", " << lambda << ", " << fptr << ", " << natural << ", " << stdlist << std::endl;
+	}
+
+	std::cout << list_size << " elements added in batches of " << batch_size << ", us total" << std::endl;
+	std::cout << "add() + sort(), insert_sorted(), merge(sorted batch)" << std::endl;
+	double resort = bench_batches([](LinkedListCore<int> &l, const std::vector<int> &batch){
+		l.add_range(batch.begin(), batch.end());
+		l.sort();
+	}, checksum);
+	double insert = bench_batches([](LinkedListCore<int> &l, const std::vector<int> &batch){
+		for (int i : batch)
+			l.insert_sorted(i);
+	}, checksum);
+	double merge = bench_batches([](LinkedListCore<int> &l, const std::vector<int> &batch){
+		LinkedListCore<int> sorted;
+		sorted.add_range(batch.begin(), batch.end());
+		sorted.sort();
+		l.merge(sorted);
+	}, checksum);
+	std::cout << resort << ", " << insert << ", " << merge << std::endl;
+
+	std::cout << "checksum: " << checksum << std::endl;
+}
@@ -0,0 +1,50 @@
+//g++ -O2 -std=c++14 unrolled_bench.cpp -o unrolled_bench && ./unrolled_bench
+
+/*
+	LinkedList vs UnrolledLinkedList storing small objects
+
+	Compares node memory footprint, full scan and deep-copy speed
+	for a list of uint16_t samples
+*/
+
+#include "../../LinkedList.h"
+#include "../../UnrolledLinkedList.h"
+#include <chrono>
+#include <iostream>
+#include <stdint.h>
+
+static const unsigned samples = 100000;
+static const unsigned repeat = 50;
+
+template<class List>
+void bench(const char *name, size_t node_size, size_t items_per_node){
+	List list;
+	for (unsigned i = 0; i != samples; ++i)
+		list.add(static_cast<uint16_t>(i));
+
+	unsigned long sum = 0;
+	auto t1 = std::chrono::steady_clock::now();
+	for (unsigned r = 0; r != repeat; ++r){
+		for (const auto& i : list)
+			sum += i;
+	}
+	auto t2 = std::chrono::steady_clock::now();
+	for (unsigned r = 0; r != repeat; ++r){
+		List copy(list);
+		sum += copy.size();
+	}
+	auto t3 = std::chrono::steady_clock::now();
+
+	size_t nodes = (samples + items_per_node - 1) / items_per_node;
+	std::cout << name << ": node memory " << nodes * node_size / 1024 << " KiB"
+		<< ", scan " << std::chrono::duration<double, std::micro>(t2 - t1).count() / repeat << " us"
+		<< ", copy " << std::chrono::duration<double, std::micro>(t3 - t2).count() / repeat << " us"
+		<< " (checksum " << sum << ")" << std::endl;
+}
+
+int main(){
+	std::cout << samples << " uint16_t samples, node memory excludes allocator overhead" << std::endl;
+	bench< LinkedList<uint16_t> >("LinkedList             ", sizeof(ListNode<uint16_t>), 1);
+	bench< UnrolledLinkedList<uint16_t, 8> >("UnrolledLinkedList<8>  ", sizeof(UnrolledNode<uint16_t, 8>), 8);
+	bench< UnrolledLinkedList<uint16_t, 32> >("UnrolledLinkedList<32> ", sizeof(UnrolledNode<uint16_t, 32>), 32);
+}
@@ -0,0 +1,63 @@
+//g++ -O2 -std=c++14 virtual_bench.cpp -o virtual_bench && ./virtual_bench
+
+/*
+	Per-call overhead of virtual LinkedList vs non-virtual LinkedListCore
+
+	LinkedList is used via a reference to the base class of unknown dynamic type,
+	so calls go through vtable like in a program passing lists around,
+	LinkedListCore calls are resolved at compile time and inlined
+*/
+
+#include "../../LinkedList.h"
+#include <chrono>
+#include <iostream>
+
+static const unsigned list_size = 10000;
+static const unsigned rounds = 50;
+
+struct Result {
+	double add = 0, get = 0, shift = 0;
+};
+
+template<class List>
+void bench(List &list, Result &res, unsigned long &checksum){
+	for (unsigned r = 0; r != rounds; ++r){
+		auto t1 = std::chrono::steady_clock::now();
+		for (unsigned i = 0; i != list_size; ++i)
+			list.add(i);
+		auto t2 = std::chrono::steady_clock::now();
+		// sequential access is served by node cache
+		for (unsigned i = 0; i != list_size; ++i)
+			checksum += list.get(i);
+		auto t3 = std::chrono::steady_clock::now();
+		while (list.size())
+			checksum += list.shift();
+		auto t4 = std::chrono::steady_clock::now();
+
+		res.add += std::chrono::duration<double, std::nano>(t2 - t1).count();
+		res.get += std::chrono::duration<double, std::nano>(t3 - t2).count();
+		res.shift += std::chrono::duration<double, std::nano>(t4 - t3).count();
+	}
+}
+
+int main(){
+	unsigned long checksum = 0;
+	const double ops = double(list_size) * rounds;
+
+	// hide dynamic type from the optimizer
+	LinkedList<unsigned> list;
+	LinkedList<unsigned> * volatile vlist = &list;
+	Result virt;
+	bench(*vlist, virt, checksum);
+
+	LinkedListCore<unsigned> core;
+	Result direct;
+	bench(core, direct, checksum);
+
+	std::cout << "method, LinkedList (virtual) ns/call, LinkedListCore ns/call" << std::endl;
+	std::cout << "add, " << virt.add / ops << ", " << direct.add / ops << std::endl;
+	std::cout << "get, " << virt.get / ops << ", " << direct.get / ops << std::endl;
+	std::cout << "shift, " << virt.shift / ops << ", " << direct.shift / ops << std::endl;
+	std::cout << "sizeof, " << sizeof(list) << ", " << sizeof(core) << std::endl;
+	std::cout << "checksum: " << checksum << std::endl;
+}
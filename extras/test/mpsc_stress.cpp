@@ -0,0 +1,126 @@
+//g++ -Wall -std=c++14 -pthread mpsc_stress.cpp -o mpsc_stress && ./mpsc_stress
+
+/*
+	MPSCQueue stress test
+	several producers add sequences of tagged values concurrently,
+	a single consumer checks nothing is lost, duplicated or reordered within a producer
+*/
+
+#include "../../MPSCQueue.h"
+#include <assert.h>
+#include <iostream>
+#include <thread>
+#include <vector>
+
+static const unsigned producers = 8;
+static const unsigned per_producer = 200000;
+
+struct Msg {
+    unsigned producer = 0;
+    unsigned seq = 0;
+    Msg(){}
+    Msg(unsigned p, unsigned s) : producer(p), seq(s) {}
+};
+
+void GivenEmptyQueue_WhenShiftCalled_ThenReturnsFalse()
+{
+    //Arrange
+    MPSCQueue<int> q;
+    int v = 5;
+
+    //Act Assert
+    assert(q.empty() == true);
+    assert(q.shift(v) == false);
+    assert(v == 5);
+
+    q.add(1);
+    q.emplace_back(2);
+    assert(q.empty() == false);
+    assert(q.shift(v) == true && v == 1);
+    assert(q.shift(v) == true && v == 2);
+    assert(q.shift(v) == false);
+
+    // objects left in a queue are released on destruction
+    q.add(3);
+}
+
+// no default constructor, queue must not need one
+struct Event {
+    int id;
+    explicit Event(int i) : id(i) {}
+};
+
+void GivenPooledQueue_WhenPoolExhausted_ThenAddReturnsFalse()
+{
+    //Arrange
+    MPSCQueue<Event, AtomicNodePool<ListNode<Event>, 4> > q;
+    Event e(-1);
+
+    //Act Assert - one node of the pool is the stub
+    for (int i = 0; i != 3; ++i)
+        assert(q.emplace_back(i) == true);
+    assert(q.add(Event(3)) == false);
+    assert(q.shift(e) == true && e.id == 0);
+    assert(q.add(Event(3)) == true);
+    for (int i = 1; i != 4; ++i)
+        assert(q.shift(e) == true && e.id == i);
+    assert(q.shift(e) == false);
+
+    // nodes go back to the pool on clear()
+    for (int i = 0; i != 3; ++i)
+        assert(q.emplace_back(i) == true);
+    q.clear();
+    assert(q.empty() == true);
+    for (int i = 0; i != 3; ++i)
+        assert(q.emplace_back(i) == true);
+}
+
+template<class Queue>
+void GivenManyProducers_WhenAddConcurrently_ThenConsumerGetsAllInOrder()
+{
+    //Arrange
+    Queue q;
+    std::vector<unsigned> next_seq(producers, 0);
+    std::vector<std::thread> threads;
+
+    //Act
+    for (unsigned p = 0; p != producers; ++p){
+        threads.emplace_back([&q, p](){
+            for (unsigned i = 0; i != per_producer; ++i)
+                while (!q.emplace_back(p, i))
+                    std::this_thread::yield();
+        });
+    }
+
+    unsigned long received = 0;
+    Msg m;
+    while (received != (unsigned long)producers * per_producer){
+        if (!q.shift(m)){
+            std::this_thread::yield();
+            continue;
+        }
+        //Assert - per-producer FIFO order, no loss, no duplicates
+        assert(m.producer < producers);
+        assert(m.seq == next_seq[m.producer]);
+        ++next_seq[m.producer];
+        ++received;
+    }
+
+    for (auto& t : threads)
+        t.join();
+
+    assert(q.empty());
+    for (unsigned p = 0; p != producers; ++p)
+        assert(next_seq[p] == per_producer);
+}
+
+int main()
+{
+    GivenEmptyQueue_WhenShiftCalled_ThenReturnsFalse();
+    GivenPooledQueue_WhenPoolExhausted_ThenAddReturnsFalse();
+    GivenManyProducers_WhenAddConcurrently_ThenConsumerGetsAllInOrder< MPSCQueue<Msg> >();
+    // small pool runs out often, so producers and consumer contend for the free chain
+    GivenManyProducers_WhenAddConcurrently_ThenConsumerGetsAllInOrder< MPSCQueue<Msg, AtomicNodePool<ListNode<Msg>, 64> > >();
+
+    std::cout<< "MPSC stress tests pass"<< std::endl;
+}
@@ -1,8 +1,20 @@
 //g++ -Wall -std=c++14 tests.cpp -o tests && ./tests
 
 #include "../../LinkedList.h"
+#include "../../DLinkedList.h"
+#include "../../UnrolledLinkedList.h"
+#include "../../ConcurrentLinkedList.h"
+#include "../../IndexedLinkedList.h"
+#include "../../IntrusiveLinkedList.h"
+#include "../../StaticLinkedList.h"
+#include "../../CompactLinkedList.h"
+#include "../../HashedLinkedList.h"
+#include "../../SortedLinkedList.h"
+#include "../../RingBufferList.h"
 #include <assert.h> 
+#include <functional>
 #include <iostream>
+#include <string>
 
 void GivenNothingInList_WhenSizeCalled_Returns0()
 {
@@ -434,6 +446,1509 @@ void GivenList_makeclone(){
     assert(clone[1] == 6);          // chk value
 }
 
+/**
+ * @brief test list with nodes taken from fixed-capacity pool
+ * 
+ */
+void GivenPooledList_WhenPoolExhausted_ThenAddFailsAndNodesRecycled(){
+    //Arrange
+    PooledLinkedList<int, 3> list;
+
+    //Act Assert
+    assert(list.add(0) == true);
+    assert(list.add(1) == true);
+    assert(list.unshift(2) == true);
+    assert(list.add(3) == false);       // pool is full
+    assert(list.add(1, 3) == false);    // pool is full
+    assert(list.unshift(3) == false);   // pool is full
+    assert(list.size() == 3);
+    assert(list.get(0) == 2);
+    assert(list.get(2) == 1);
+
+    // released nodes must be reused
+    assert(list.shift() == 2);
+    assert(list.add(4) == true);
+    assert(list.pop() == 4);
+    assert(list.add(1, 5) == true);
+    assert(list.size() == 3);
+    assert(list.get(0) == 0);
+    assert(list.get(1) == 5);
+    assert(list.get(2) == 1);
+
+    list.clear();
+    for (int i = 0; i != 3; ++i)
+        assert(list.add(i) == true);
+    assert(list.add(3) == false);
+
+    // clone gets it's own pool
+    PooledLinkedList<int, 3> clone(list);
+    assert(clone.size() == 3);
+    assert(clone[2] == 2);
+}
+
+// payload type counting copies of itself
+struct CopyCounter {
+    static int copies;
+    int v;
+    CopyCounter(int _v = 0) : v(_v) {}
+    CopyCounter(int a, int b) : v(a + b) {}
+    CopyCounter(const CopyCounter& rhs) : v(rhs.v) { ++copies; }
+    CopyCounter(CopyCounter&& rhs) : v(rhs.v) { rhs.v = -1; }
+    CopyCounter& operator=(const CopyCounter& rhs) { v = rhs.v; ++copies; return *this; }
+    CopyCounter& operator=(CopyCounter&& rhs) { v = rhs.v; rhs.v = -1; return *this; }
+};
+int CopyCounter::copies = 0;
+
+/**
+ * @brief test emplace and rvalue methods do not copy objects
+ * 
+ */
+void GivenList_WhenEmplacedAndMoved_ThenNoCopiesMade(){
+    //Arrange
+    LinkedList<CopyCounter> list;
+    CopyCounter::copies = 0;
+
+    //Act
+    list.emplace_back(1);
+    list.emplace_back(1, 1);        // 2
+    list.emplace_front(0);
+    list.emplace(1, 5);             // 0 5 1 2
+    list.add(CopyCounter(3));
+    list.add(1, CopyCounter(6));    // 0 6 5 1 2 3
+    list.unshift(CopyCounter(7));   // 7 0 6 5 1 2 3
+    CopyCounter c(8);
+    list.set(0, std::move(c));      // 8 0 6 5 1 2 3
+
+    //Assert
+    assert(list.size() == 7);
+    assert(list[0].v == 8);
+    assert(list[1].v == 0);
+    assert(list[2].v == 6);
+    assert(list[3].v == 5);
+    assert(list[6].v == 3);
+    assert(list.pop().v == 3);
+    assert(list.shift().v == 8);
+    assert(list.remove(1).v == 6);
+    assert(CopyCounter::copies == 0);
+
+    // lvalues are still copied
+    list.add(c);
+    assert(CopyCounter::copies == 1);
+}
+
+/**
+ * @brief test move constructor and move assignment
+ * 
+ */
+void GivenList_WhenMoved_ThenNodesTakenOver(){
+    //Arrange
+    LinkedList<CopyCounter> list;
+    list.emplace_back(0);
+    list.emplace_back(1);
+    list.emplace_back(2);
+    CopyCounter::copies = 0;
+
+    //Act
+    LinkedList<CopyCounter> moved(std::move(list));
+
+    //Assert
+    assert(list.size() == 0);
+    assert(moved.size() == 3);
+    assert(moved[1].v == 1);
+    assert(moved.back().v == 2);
+    list.emplace_back(5);           // moved-from list is still usable
+    assert(list[0].v == 5);
+
+    //Act
+    list = std::move(moved);
+    assert(moved.size() == 0);
+    assert(list.size() == 3);
+    assert(list[0].v == 0);
+    assert(list[2].v == 2);
+
+    // pooled nodes are not transfered, objects are moved into own pool
+    PooledLinkedList<CopyCounter, 3> pooled;
+    pooled.emplace_back(0);
+    pooled.emplace_back(1);
+    PooledLinkedList<CopyCounter, 3> pooled2(std::move(pooled));
+    assert(pooled.size() == 0);
+    assert(pooled2.size() == 2);
+    assert(pooled2[1].v == 1);
+    assert(CopyCounter::copies == 1);   // the one made by moved.back()
+}
+
+int cmp_int(int &a, int &b){ return a - b; }
+
+/**
+ * @brief test doubly linked list
+ * 
+ */
+void GivenDList_WhenAccessedFromBothEnds_ThenReturnsData(){
+    //Arrange
+    DLinkedList<int> list;
+    for (int i = 0; i != 10; ++i)
+        list.add(i);
+
+    //Act Assert
+    assert(list.size() == 10);
+    assert(list.get(9) == 9);
+    assert(list.get(1) == 1);
+    assert(list.get(7) == 7);
+    assert(list[4] == 4);
+    assert(list.pop() == 9);
+    assert(list.pop() == 8);
+    assert(list.shift() == 0);      // 1..7
+    assert(list.front() == 1);
+    assert(list.back() == 7);
+
+    list.add(3, 10);                // 1 2 3 10 4 5 6 7
+    list.unshift(0);                // 0 1 2 3 10 4 5 6 7
+    assert(list.get(4) == 10);
+    assert(list.remove(4) == 10);
+    list.unlink(7);                 // 0 1 2 3 4 5 6
+    assert(list.size() == 7);
+
+    // walk forward and backward
+    int expected = 0;
+    for (auto i = list.cbegin(); i != list.cend(); ++i)
+        assert(*i == expected++);
+    assert(expected == 7);
+
+    for (auto i = list.rbegin(); i != list.rend(); ++i)
+        assert(*i == --expected);
+    assert(expected == 0);
+
+    auto it = list.end();
+    --it;
+    assert(*it == 6);
+
+    // pop everything
+    for (int i = 6; i >= 0; --i)
+        assert(list.pop() == i);
+    assert(list.size() == 0);
+    assert(list.pop() == 0);
+    assert(list.begin() == list.end());
+}
+
+void GivenDList_WhenSortedAndCopied_ThenLinksConsistent(){
+    //Arrange
+    DLinkedList<int> list;
+    int data[] = {5, 3, 8, 1, 9, 2, 7};
+    for (int i : data)
+        list.add(i);
+
+    //Act
+    list.sort(cmp_int);
+
+    //Assert
+    DLinkedList<int> clone(list);
+    int prev = 10;
+    for (auto i = clone.rbegin(); i != clone.rend(); ++i){
+        assert(*i < prev);
+        prev = *i;
+    }
+    assert(clone.back() == 9);
+    assert(clone.get(0) == 1);
+
+    DLinkedList<int> moved(std::move(clone));
+    assert(clone.size() == 0);
+    assert(moved.size() == 7);
+    assert(moved.pop() == 9);
+    assert(moved.back() == 8);
+}
+
+/**
+ * @brief test unrolled list splits and merges it's nodes keeping objects order
+ * 
+ */
+void GivenUnrolledList_WhenInsertedAndRemoved_ThenOrderKept(){
+    //Arrange
+    UnrolledLinkedList<int, 4> list;
+    LinkedList<int> ref;
+    for (int i = 0; i != 20; ++i){
+        list.add(i);
+        ref.add(i);
+    }
+
+    //Act - insert into full nodes, remove from the middle and both ends
+    for (int i = 0; i != 10; ++i){
+        list.add(i * 3, 100 + i);
+        ref.add(i * 3, 100 + i);
+    }
+    list.unshift(-1);
+    ref.unshift(-1);
+    list.emplace(7, 200);
+    ref.emplace(7, 200);
+    for (unsigned i = 0; i != 8; ++i){
+        assert(list.remove(i * 2) == ref.remove(i * 2));
+    }
+    assert(list.pop() == ref.pop());
+    assert(list.shift() == ref.shift());
+    list.unlink(5);
+    ref.unlink(5);
+    list.set(3, 300);
+    ref.set(3, 300);
+
+    //Assert
+    assert(list.size() == ref.size());
+    for (unsigned i = 0; i != ref.size(); ++i)
+        assert(list.get(i) == ref.get(i));
+    auto r = ref.cbegin();
+    for (const auto& i : list)
+        assert(i == *r++);
+    assert(list.front() == ref.front());
+    assert(list.back() == ref.back());
+
+    // drain from the back
+    while (ref.size())
+        assert(list.pop() == ref.pop());
+    assert(list.size() == 0);
+    assert(list.begin() == list.end());
+}
+
+void GivenUnrolledList_WhenSortedAndCopied_ThenOrderKept(){
+    //Arrange
+    UnrolledLinkedList<int, 3> list;
+    int data[] = {5, 3, 8, 1, 9, 2, 7, 3, 5, 0, 4};
+    for (int i : data)
+        list.add(i);
+
+    //Act
+    list.sort(cmp_int);
+    UnrolledLinkedList<int, 3> clone(list);
+
+    //Assert
+    assert(clone.size() == 11);
+    int prev = -1;
+    for (const auto& i : clone){
+        assert(i >= prev);
+        prev = i;
+    }
+    assert(clone[0] == 0);
+    assert(clone[10] == 9);
+
+    UnrolledLinkedList<int, 3> moved(std::move(clone));
+    assert(clone.size() == 0);
+    assert(moved.size() == 11);
+    assert(moved.shift() == 0);
+}
+
+/**
+ * @brief test thread-safe list reads with caller's cursor
+ * 
+ */
+void GivenConcurrentList_WhenReadWithCursor_ThenCursorFollowsChanges(){
+    //Arrange
+    ConcurrentLinkedList<int> list;
+    for (int i = 0; i != 10; ++i)
+        list.add(i);
+    ConcurrentLinkedList<int>::ReadCursor cursor;
+
+    //Act Assert
+    for (int i = 0; i != 10; ++i)
+        assert(list.get(i, cursor) == i);
+    assert(cursor.index == 8);          // last element is taken directly
+    assert(list.get(10, cursor) == 0);
+
+    // cursor must be discarded after list change
+    list.shift();
+    list.unshift(-1);
+    list.add(5, 50);                    // -1 1 2 3 4 50 5 6 7 8 9
+    assert(list.get(5, cursor) == 50);
+    assert(list.get(6, cursor) == 5);
+    assert(list.get(1) == 1);
+    assert(list.size() == 11);
+    assert(list.front() == -1);
+    assert(list.back() == 9);
+    assert(list.remove(5) == 50);
+    assert(list.get(5, cursor) == 5);
+
+    int sum = 0;
+    list.for_each([&sum](const int& i){ sum += i; });
+    assert(sum == 44);
+
+    int out = 0;
+    assert(list.try_get(2, out) == true && out == 2);
+    assert(list.try_shift(out) == true && out == -1);
+    assert(list.try_pop(out) == true && out == 9);
+    list.clear();
+    assert(list.try_shift(out) == false && out == 9);
+}
+
+/**
+ * @brief test cursor access and editing
+ * 
+ */
+void GivenList_WhenEditedViaCursor_ThenListConsistent(){
+    //Arrange
+    LinkedList<int> list;
+    for (int i = 0; i != 5; ++i)
+        list.add(i);
+
+    //Act Assert
+    auto c = list.cursor(1);
+    assert(c.valid() && *c == 1);
+    assert(c.insert_after(10));         // 0 1 10 2 3 4
+    assert(c.advance(2) && *c == 2);
+    assert(c.index() == 3);
+    assert(c.erase_after());            // 0 1 10 2 4
+    assert(c.advance() && c.get() == 4);
+    assert(c.insert_after(20));         // 0 1 10 2 4 20
+    assert(list.back() == 20);
+    assert(list.size() == 6);
+    assert(c.erase_after());            // 0 1 10 2 4
+    assert(list.back() == 4);
+    assert(c.erase_after() == false);
+    assert(c.advance() == false);
+    assert(c.valid() == false);
+    assert(c.seek(2) && *c == 10);
+    assert(c.seek(0) && *c == 0);
+    assert(c.seek(5) == false);
+
+    // list index access must be consistent after cursor changes
+    int expected[] = {0, 1, 10, 2, 4};
+    for (unsigned i = 0; i != 5; ++i)
+        assert(list[i] == expected[i]);
+    assert(list.get(2) == 10);
+    assert(list.remove(3) == 2);
+
+    //Act Assert - stale cursor index does not leak into list's node cache
+    LinkedList<int> shifted;
+    for (int i = 0; i != 5; ++i)
+        shifted.add(i * 10);
+    auto s = shifted.cursor(2);
+    shifted.unshift(-1);                // -1 0 10 20 30 40, cursor still says 2
+    assert(s.insert_after(25));         // -1 0 10 20 25 30 40
+    assert(shifted.get(5) == 30);
+    assert(shifted[6] == 40);
+    assert(s.erase_after());            // -1 0 10 20 30 40
+    assert(shifted.get(4) == 30);
+    assert(shifted[5] == 40);
+}
+
+void GivenList_WhenEditedWhileIterating_ThenListConsistent(){
+    //Arrange
+    LinkedList<int> list;
+    for (int i = 0; i != 6; ++i)
+        list.add(i);
+
+    //Act - drop every odd element, duplicate every even one
+    for (auto i = list.begin(); i != list.end(); ++i){
+        i.erase_after();
+        i.insert_after(*i);
+        ++i;
+    }
+
+    //Assert
+    int expected[] = {0, 0, 2, 2, 4, 4};
+    assert(list.size() == 6);
+    for (unsigned i = 0; i != 6; ++i)
+        assert(list.get(i) == expected[i]);
+    assert(list.back() == 4);
+    assert(list.end().insert_after(1) == false);
+}
+
+/**
+ * @brief test skip list positional access matches plain list
+ * 
+ */
+void GivenIndexedList_WhenAccessedRandomly_ThenMatchesLinkedList(){
+    //Arrange
+    IndexedLinkedList<int> list;
+    LinkedList<int> ref;
+    for (int i = 0; i != 200; ++i){
+        list.add(i);
+        ref.add(i);
+    }
+
+    //Act
+    unsigned idx = 7;
+    for (int i = 0; i != 300; ++i){
+        idx = (idx * 31 + 17) % ref.size();
+        switch (i % 4){
+        case 0: list.add(idx, 1000 + i); ref.add(idx, 1000 + i); break;
+        case 1: assert(list.remove(idx) == ref.remove(idx)); break;
+        case 2: list.set(idx, i); ref.set(idx, i); break;
+        case 3: assert(list.get(idx) == ref.get(idx)); break;
+        }
+    }
+    list.unshift(-1);
+    ref.unshift(-1);
+    assert(list.pop() == ref.pop());
+    assert(list.shift() == ref.shift());
+
+    //Assert
+    assert(list.size() == ref.size());
+    for (unsigned i = 0; i != ref.size(); ++i)
+        assert(list[i] == ref[i]);
+    assert(list.front() == ref.front());
+    assert(list.back() == ref.back());
+
+    //Act - sort keeps positional index consistent
+    list.sort(cmp_int);
+    ref.sort(cmp_int);
+    IndexedLinkedList<int> clone(list);
+    auto r = ref.cbegin();
+    for (const auto& i : clone)
+        assert(i == *r++);
+    for (unsigned i = 0; i != ref.size(); i += 13)
+        assert(clone.get(i) == ref.get(i));
+    assert(clone.back() == ref.back());
+}
+
+struct KeyValue {
+    int key;
+    int value;
+};
+
+// sorts by key, values are in insertion order, so equal keys must keep ascending values
+template<class List>
+void check_stable_sort(List &list)
+{
+    int field = 0;  // runtime-chosen sort field
+    for (int i = 0; i != 100; ++i)
+        list.add(KeyValue{(i * 7) % 5, i});
+
+    list.sort([field](const KeyValue &a, const KeyValue &b){ return (field ? a.value : a.key) < (field ? b.value : b.key); });
+
+    assert(list.size() == 100);
+    auto prev = list.begin();
+    for (auto i = list.begin(); ++i != list.end(); prev = i)
+        assert((*prev).key < (*i).key || ((*prev).key == (*i).key && (*prev).value < (*i).value));
+}
+
+void GivenLists_WhenSortedWithLambda_ThenSortIsStable()
+{
+    LinkedList<KeyValue> list;
+    check_stable_sort(list);
+    DLinkedList<KeyValue> dlist;
+    check_stable_sort(dlist);
+    UnrolledLinkedList<KeyValue, 4> ulist;
+    check_stable_sort(ulist);
+    IndexedLinkedList<KeyValue> ilist;
+    check_stable_sort(ilist);
+}
+
+void GivenList_WhenSortedWithFunctors_ThenOrderMatches()
+{
+    //Arrange
+    LinkedList<int> list;
+    for (int i = 0; i != 50; ++i)
+        list.add((i * 37) % 50);
+
+    //Act Assert - default std::less<>
+    list.sort();
+    for (int i = 0; i != 50; ++i)
+        assert(list.get(i) == i);
+
+    //Act Assert - functor
+    list.sort(std::greater<int>());
+    for (int i = 0; i != 50; ++i)
+        assert(list.get(i) == 49 - i);
+
+    //Act Assert - strcmp-like lambda is not taken for a 'less' predicate
+    list.sort([](int &a, int &b){ return a - b; });
+    for (int i = 0; i != 50; ++i)
+        assert(list[i] == i);
+    assert(list.back() == 49);
+}
+
+void GivenTwoLists_WhenSplicedAndSplit_ThenNodesRelinked()
+{
+    //Arrange
+    LinkedList<int> list, other;
+    for (int i = 0; i != 4; ++i){
+        list.add(i);        // 0 1 2 3
+        other.add(10 + i);  // 10 11 12 13
+    }
+    const int *node = &other[1];
+
+    //Act - splice in the middle
+    assert(list.splice(2, other) == true);
+
+    //Assert
+    assert(other.size() == 0);
+    assert(list.size() == 8);
+    assert(&list[3] == node);   // relinked, not copied
+    const int expect[] = {0, 1, 10, 11, 12, 13, 2, 3};
+    for (int i = 0; i != 8; ++i)
+        assert(list.get(i) == expect[i]);
+    assert(list.back() == 3);
+
+    //Act - split and append back
+    LinkedList<int> rest = list.split_at(5);
+    assert(list.size() == 5);
+    assert(list.back() == 12);
+    assert(rest.size() == 3);
+    assert(rest.front() == 13);
+    assert(rest.back() == 3);
+    assert(list.append(std::move(rest)) == true);
+    assert(rest.size() == 0);
+    assert(list.size() == 8);
+    assert(list.back() == 3);
+
+    //Act - move a range to the front of other list
+    assert(other.add(99) == true);
+    assert(other.splice_range(0, list, 2, 4) == true);
+    assert(other.size() == 5);
+    for (int i = 0; i != 4; ++i)
+        assert(other[i] == 10 + i);
+    assert(other.back() == 99);
+    assert(list.size() == 4);
+    assert(list.get(1) == 1);
+    assert(list.get(2) == 2);
+    assert(list.back() == 3);
+
+    //Act - range is clipped, self splice is rejected
+    assert(other.splice_range(10, list, 3, 100) == true);
+    assert(other.back() == 3);
+    assert(list.back() == 2);
+    assert(list.splice(0, list) == false);
+
+    // both lists stay usable
+    list.add(7);
+    other.unshift(-1);
+    assert(list.size() == 4 && list.get(3) == 7);
+    assert(other.size() == 7 && other.get(0) == -1 && other.get(6) == 3);
+}
+
+void GivenPooledLists_WhenSpliced_ThenObjectsMoved()
+{
+    //Arrange
+    PooledLinkedList<int, 4> list, other;
+    list.add(0);
+    list.add(1);
+    for (int i = 0; i != 3; ++i)
+        other.add(10 + i);
+
+    //Act Assert - pools are not shared, objects are moved until the pool is full
+    assert(list.splice(1, other) == false);
+    assert(list.size() == 4);
+    assert(list.get(1) == 10);
+    assert(list.get(2) == 11);
+    assert(list.get(3) == 1);
+    assert(other.size() == 1);
+    assert(other.front() == 12);
+
+    PooledLinkedList<int, 4> rest = list.split_at(2);
+    assert(list.size() == 2);
+    assert(rest.size() == 2);
+    assert(rest.back() == 1);
+}
+
+void GivenList_WhenBulkEdited_ThenElementsMatch()
+{
+    //Arrange
+    LinkedList<int> list;
+    const int values[] = {1, 1, 2, 3, 3, 3, 4, 5, 5};
+
+    //Act Assert - bulk insertion
+    assert(list.add_range(values, values + 9) == true);
+    assert(list.size() == 9);
+    assert(list.back() == 5);
+    const int more[] = {-2, -1};
+    assert(list.insert_range(0, more, more + 2) == true);
+    assert(list.insert_range(4, more, more) == true);
+    assert(list.size() == 11);
+    assert(list.get(0) == -2);
+    assert(list.get(2) == 1);
+
+    //Act Assert - remove duplicates and filter
+    assert(list.unique() == 4);
+    const int uniq[] = {-2, -1, 1, 2, 3, 4, 5};
+    assert(list.size() == 7);
+    for (int i = 0; i != 7; ++i)
+        assert(list[i] == uniq[i]);
+
+    assert(list.remove_if([](const int &v){ return v < 0 || v == 5; }) == 3);
+    assert(list.size() == 4);
+    assert(list.front() == 1);
+    assert(list.back() == 4);
+
+    //Act Assert - erase range
+    assert(list.erase_range(1, 3) == 2);
+    assert(list.size() == 2);
+    assert(list.get(0) == 1);
+    assert(list.get(1) == 4);
+    assert(list.erase_range(1, 100) == 1);
+    assert(list.back() == 1);
+    assert(list.remove_if([](const int &){ return true; }) == 1);
+    assert(list.size() == 0);
+    assert(list.add(7) == true);
+    assert(list.front() == 7 && list.back() == 7);
+
+    //Act Assert - failed bulk insertion leaves the list untouched
+    PooledLinkedList<int, 4> pooled;
+    pooled.add(0);
+    assert(pooled.add_range(values, values + 4) == false);
+    assert(pooled.size() == 1);
+    assert(pooled.insert_range(0, values, values + 3) == true);
+    assert(pooled.size() == 4);
+    assert(pooled.back() == 0);
+}
+
+// object which could be linked to two intrusive lists at once
+struct Timer {
+    int deadline;
+    IntrusiveHook<Timer> byDeadline;
+    IntrusiveHook<Timer> active;
+};
+
+void GivenIntrusiveList_WhenObjectsLinked_ThenNoCopiesMade()
+{
+    //Arrange
+    Timer timers[6];
+    for (int i = 0; i != 6; ++i)
+        timers[i].deadline = (i * 5) % 6;   // 0 5 4 3 2 1
+    IntrusiveLinkedList<Timer, &Timer::byDeadline> queue;
+    IntrusiveLinkedList<Timer, &Timer::active> active;
+
+    //Act
+    for (auto &t : timers)
+        queue.add(t);
+    active.add(timers[1]);
+    active.unshift(timers[3]);
+    active.add(1, timers[5]);
+
+    //Assert
+    assert(queue.size() == 6);
+    assert(queue.get(2) == &timers[2]);
+    assert(active.size() == 3);
+    assert(active.front() == &timers[3]);
+    assert(active[1].deadline == 1);
+    assert(active.back() == &timers[1]);
+
+    //Act Assert - sort relinks objects, other list is not affected
+    queue.sort([](const Timer &a, const Timer &b){ return a.deadline < b.deadline; });
+    int expect = 0;
+    for (const auto &t : queue)
+        assert(t.deadline == expect++);
+    assert(queue.back() == &timers[1]);
+    assert(active.get(2) == &timers[1]);
+
+    //Act Assert - unlink while iterating
+    for (auto i = queue.begin(); i != queue.end(); ++i)
+        if (i->deadline % 2)
+            queue.unlink(*i);
+    assert(queue.size() == 3);
+    assert(queue.back()->deadline == 4);
+    assert(queue.unlink(timers[1]) == false);
+
+    assert(queue.shift() == &timers[0]);
+    assert(queue.pop() == &timers[2]);
+    assert(queue.remove(5) == nullptr);
+    assert(queue.size() == 1);
+    assert(active.remove(1) == &timers[5]);
+    assert(active.size() == 2);
+
+    // objects are free to be linked again
+    queue.add(timers[0]);
+    queue.unshift(timers[2]);
+    assert(queue.size() == 3);
+    assert(queue.back() == &timers[0]);
+}
+
+void GivenStaticList_WhenFull_ThenAddFailsAndNodesReused()
+{
+    //Arrange
+    StaticLinkedList<int, 4> list;
+    static_assert(sizeof(StaticLinkedList<int, 4>::index_t) == 1, "byte links for small lists");
+    static_assert(sizeof(StaticLinkedList<char, 300>::index_t) == 2, "word links for big lists");
+
+    //Act Assert
+    assert(list.add(3) == true);
+    assert(list.unshift(1) == true);
+    assert(list.add(1, 2) == true);
+    assert(list.emplace_back(0) == true);
+    assert(list.add(5) == false);       // list is full
+    assert(list.unshift(5) == false);
+    assert(list.available() == 0);
+    assert(list.size() == 4);
+    for (int i = 0; i != 3; ++i)
+        assert(list.get(i) == i + 1);
+
+    //Act Assert - sort and iterate
+    list.sort();
+    int expect = 0;
+    for (int &i : list)
+        assert(i == expect++);
+    assert(list.back() == 3);
+
+    //Act Assert - released nodes are reused
+    assert(list.remove(1) == 1);
+    assert(list.pop() == 3);
+    assert(list.shift() == 0);
+    assert(list.add(7) == true);
+    assert(list.add(0, 8) == true);
+    assert(list.add(1, 9) == true);
+    assert(list.size() == 4);
+    assert(list[0] == 8 && list[1] == 9 && list[2] == 2 && list[3] == 7);
+    assert(list.add(10) == false);
+
+    //Act Assert - copies keep order
+    StaticLinkedList<int, 4> clone(list);
+    list.clear();
+    assert(list.size() == 0);
+    assert(clone.size() == 4);
+    assert(clone.back() == 7);
+    StaticLinkedList<int, 4> moved(std::move(clone));
+    assert(clone.size() == 0);
+    assert(moved.get(1) == 9);
+}
+
+void GivenCompactList_WhenSizeTypeExhausted_ThenAddFails()
+{
+    //Arrange
+    CompactLinkedList<int, uint8_t> list;
+    static_assert(sizeof(CompactLinkedList<int>) <= 3 * sizeof(void*), "no vtable and no node cache");
+
+    //Act
+    for (int i = 0; i != 255; ++i)
+        assert(list.add(i) == true);
+
+    //Assert
+    assert(list.add(255) == false);     // uint8_t size is full
+    assert(list.unshift(-1) == false);
+    assert(list.size() == 255);
+    assert(list.back() == 254);
+
+    list.sort([](int a, int b){ return a > b; });
+    assert(list.front() == 254);
+    assert(list.back() == 0);
+    assert(list.remove(1) == 253);
+    assert(list.add(1, 300) == true);
+    assert(list[1] == 300);
+
+    CompactLinkedList<int, uint8_t> clone(list);
+    list.clear();
+    assert(clone.size() == 255);
+    int sum = 0;
+    for (int i : clone)
+        sum += i;
+    assert(sum == 254 * 255 / 2 - 253 + 300);
+}
+
+// payload without default constructor
+struct NoDefault {
+    int v;
+    explicit NoDefault(int _v) : v(_v) {}
+    bool operator==(const NoDefault &rhs) const { return v == rhs.v; }
+};
+
+void GivenCoreList_WhenAccessedByReference_ThenNoDummyObjectsNeeded()
+{
+    //Arrange
+    LinkedListCore<NoDefault> list;
+    for (int i = 0; i != 4; ++i)
+        list.emplace_back(i);
+    NoDefault out(-1);
+
+    //Act Assert - references and pointers to objects in the list
+    assert(&list.front_ref() == &list[0]);
+    list.back_ref().v = 30;
+    assert(list[3].v == 30);
+    assert(list.find(NoDefault(2)) == &list[2]);
+    assert(list.find(NoDefault(3)) == nullptr);
+
+    //Act Assert - try-style access
+    assert(list.try_get(1, out) == true);
+    assert(out.v == 1);
+    assert(list.try_get(4, out) == false);
+    assert(out.v == 1);
+    assert(list.try_pop(out) == true);
+    assert(out.v == 30);
+    assert(list.try_shift(out) == true);
+    assert(out.v == 0);
+    assert(list.size() == 2);
+    assert(list.front_ref().v == 1);
+    assert(list.back_ref().v == 2);
+
+    list.clear();
+    assert(list.try_pop(out) == false);
+    assert(list.try_shift(out) == false);
+    assert(out.v == 0);
+}
+
+// list counting calls of overridden methods
+class CountingList : public LinkedList<int> {
+public:
+    unsigned adds = 0, shifts = 0, pops = 0, clears = 0;
+    mutable unsigned fronts = 0;
+
+    using LinkedList<int>::add;
+    bool add(const int& v) override { ++adds; return LinkedList<int>::add(v); }
+    int shift() override { ++shifts; return LinkedList<int>::shift(); }
+    int pop() override { ++pops; return LinkedList<int>::pop(); }
+    void clear() override { ++clears; LinkedList<int>::clear(); }
+    int front() const override { ++fronts; return LinkedList<int>::front(); }
+};
+
+void GivenDerivedList_WhenBaseMethodsCalled_ThenOverridesDispatched()
+{
+    static_assert(std::is_final< LinkedListCore<int> >::value, "core is not meant to be derived from");
+
+    //Arrange
+    CountingList list;
+    LinkedList<int> &base = list;
+    LinkedList<int> source(3, 7);
+
+    //Act - assignment goes via clear() and add()
+    base = source;
+
+    //Assert
+    assert(list.clears == 1);
+    assert(list.adds == 3);
+    assert(list.size() == 3);
+
+    //Act Assert - remove() takes the ends via shift() and pop()
+    list.add(8);
+    list.add(9);
+    assert(base.remove(0) == 7);
+    assert(list.shifts == 1);
+    assert(base.remove(3) == 9);
+    assert(list.pops == 1);
+    assert(base.remove(1) == 7);
+    assert(list.shifts == 1 && list.pops == 1);
+
+    //Act Assert - head() goes via front()
+    assert(base.head() == 7);
+    assert(list.fronts == 1);
+
+    //Act Assert - move assignment clears the list first
+    base = LinkedList<int>(2, 5);
+    assert(list.clears == 2);
+    assert(list.size() == 2);
+}
+
+void GivenList_WhenSearched_ThenPositionsFound()
+{
+    //Arrange
+    LinkedList<int> list;
+    for (int i : {5, 3, 8, 3})
+        list.add(i);
+    const LinkedList<int> &clist = list;
+
+    //Act Assert
+    assert(list.contains(8) == true);
+    assert(list.contains(7) == false);
+    assert(list.index_of(3) == 1);
+    assert(list.index_of(5) == 0);
+    assert(list.index_of(7) == -1);
+    assert(list.find_if([](int v){ return v > 5; }) == &list[2]);
+    assert(clist.find_if([](int v){ return v > 8; }) == nullptr);
+    *list.find_if([](int v){ return v == 3; }) = 4;
+    assert(list.index_of(3) == 3);
+}
+
+struct KeyOfKeyValue {
+    int operator()(const KeyValue &kv) const { return kv.key; }
+};
+
+// every object in the list must be found by it's key, and nothing else
+template<class List>
+void check_hash_index(const List &list, int maxKey)
+{
+    for (const KeyValue &kv : list){
+        const KeyValue *found = list.find_key(kv.key);
+        assert(found != nullptr);
+        assert(found->key == kv.key);
+    }
+    for (int k = 0; k != maxKey; ++k){
+        bool inList = false;
+        for (const KeyValue &kv : list)
+            inList = inList || kv.key == k;
+        assert(list.contains_key(k) == inList);
+    }
+}
+
+void GivenHashedList_WhenEdited_ThenIndexConsistent()
+{
+    //Arrange
+    HashedLinkedList<KeyValue, KeyOfKeyValue> list;
+
+    //Act Assert - grow the table past several rehashes
+    for (int i = 0; i != 100; ++i)
+        assert(list.add(KeyValue{(i * 37) % 100, i}) == true);
+    assert(list.size() == 100);
+    check_hash_index(list, 120);
+    assert(list.find_key(37)->value == 1);
+
+    //Act Assert - objects found by value are read-only, their key could not change behind the index
+    static_assert(std::is_same<decltype(list.find(KeyValue{37, 1})), const KeyValue*>::value, "find() must return const");
+    auto key37 = [](const KeyValue &kv){ return kv.key == 37; };
+    static_assert(std::is_same<decltype(list.find_if(key37)), const KeyValue*>::value, "find_if() must return const");
+    assert(list.find_if(key37) == list.find_key(37));
+
+    //Act Assert - every kind of edit keeps index in sync
+    list.add(10, KeyValue{100, 0});
+    list.unshift(KeyValue{101, 0});
+    assert(list.remove(5).key == (4 * 37) % 100);
+    list.unlink(50);
+    assert(list.pop().key == (99 * 37) % 100);
+    assert(list.shift().key == 101);
+    assert(list.set(0, KeyValue{110, 0}) == true);
+    assert(list.contains_key(0) == false);
+    assert(list.remove_key(100) == true);
+    assert(list.remove_key(100) == false);
+    assert(list.remove_key(110) == true);
+    check_hash_index(list, 120);
+
+    list.sort([](const KeyValue &a, const KeyValue &b){ return a.key < b.key; });
+    for (unsigned i = 1; i < list.size(); ++i)
+        assert(list[i - 1].key < list[i].key);
+    check_hash_index(list, 120);
+
+    //Act Assert - copies and moves have their own index
+    HashedLinkedList<KeyValue, KeyOfKeyValue> copy(list);
+    const KeyValue *one = list.find_key(1);
+    HashedLinkedList<KeyValue, KeyOfKeyValue> moved(std::move(list));
+    assert(moved.find_key(1) == one);
+    assert(list.size() == 0);
+    assert(list.contains_key(1) == false);
+    assert(copy.size() == moved.size());
+    check_hash_index(copy, 120);
+    check_hash_index(moved, 120);
+    assert(copy.find_key(1) != moved.find_key(1));
+
+    moved.clear();
+    assert(moved.contains_key(1) == false);
+    assert(moved.add(KeyValue{1, 1}) == true);
+    check_hash_index(moved, 120);
+
+    //Act Assert - objects moved between pools are reindexed
+    HashedLinkedList<KeyValue, KeyOfKeyValue, std::hash<int>, NodePool<ListNode<KeyValue>, 16> > pooled;
+    HashedLinkedList<KeyValue, KeyOfKeyValue, std::hash<int>, NodePool<ListNode<KeyValue>, 16> > other;
+    for (int i = 0; i != 16; ++i)
+        assert(pooled.add(KeyValue{i, i}) == true);
+    other.add(KeyValue{100, 0});
+    other = std::move(pooled);
+    assert(pooled.size() == 0 && pooled.contains_key(1) == false);
+    assert(other.size() == 16 && other.contains_key(100) == false);
+    check_hash_index(other, 120);
+}
+
+// key functor counting it's calls, a lookup takes one per probed slot
+struct CountingKeyOf {
+    static unsigned long calls;
+    int operator()(const KeyValue &kv) const { ++calls; return kv.key; }
+};
+unsigned long CountingKeyOf::calls = 0;
+
+void GivenHashedList_WhenKeysShareLowBits_ThenProbeRunsShort()
+{
+    //Arrange - std::hash<int> is identity, keys are multiples of the table size
+    HashedLinkedList<KeyValue, CountingKeyOf> list;
+    for (int i = 0; i != 500; ++i)
+        assert(list.add(KeyValue{i * 1024, i}) == true);
+
+    //Act
+    CountingKeyOf::calls = 0;
+    for (int i = 0; i != 500; ++i)
+        assert(list.find_key(i * 1024)->value == i);
+
+    //Assert - a few probes per lookup, not a walk over one run of all keys
+    assert(CountingKeyOf::calls < 500 * 4);
+
+    //Act Assert - removals keep the rest reachable
+    for (int i = 0; i < 500; i += 2)
+        assert(list.remove_key(i * 1024) == true);
+    for (int i = 0; i != 500; ++i)
+        assert(list.contains_key(i * 1024) == (i % 2 == 1));
+    assert(list.contains_key(1) == false);
+}
+
+void GivenSortedLists_WhenInsertedAndMerged_ThenOrderKept()
+{
+    //Arrange
+    LinkedList<int> list;
+    LinkedList<int> other;
+    for (int i : {7, 1, 5, 3, 5})
+        assert(list.insert_sorted(i) == true);
+    for (int i : {8, 6, 4, 2, 0})
+        assert(other.insert_sorted(i, [](int a, int b){ return a - b; }) == true);
+
+    //Act Assert - insert and bounds
+    assert(list.size() == 5);
+    assert(list[0] == 1 && list[1] == 3 && list[2] == 5 && list[3] == 5 && list[4] == 7);
+    assert(list.lower_bound(5) == 2);
+    assert(list.upper_bound(5) == 4);
+    assert(list.lower_bound(0) == 0);
+    assert(list.upper_bound(9) == 5);
+
+    //Act Assert - comparators taking non-const references, same as for sort()
+    LinkedList<int> legacy;
+    for (int i : {4, 2, 6, 2})
+        assert(legacy.insert_sorted(i, cmp_int) == true);
+    assert(legacy[0] == 2 && legacy[1] == 2 && legacy[2] == 4 && legacy[3] == 6);
+    assert(legacy.lower_bound(2, cmp_int) == 0);
+    assert(legacy.upper_bound(2, cmp_int) == 2);
+    assert(legacy.upper_bound(4, [](int &a, int &b){ return a < b; }) == 3);
+    LinkedList<int> five;
+    five.add(5);
+    assert(legacy.merge(five, cmp_int) == true);
+    assert(legacy[3] == 5);
+    SortedLinkedList<int, int(*)(int&, int&)> byCmp(cmp_int);
+    for (int i : {3, 1, 2})
+        assert(byCmp.add(i) == true);
+    assert(byCmp[0] == 1 && byCmp[2] == 3);
+    assert(byCmp.lower_bound(2) == 1);
+
+    //Act Assert - linear merge relinks nodes of other list
+    const int *two = &other[1];
+    assert(list.merge(other) == true);
+    assert(other.size() == 0);
+    assert(list.size() == 10);
+    for (unsigned i = 1; i < list.size(); ++i)
+        assert(list[i - 1] <= list[i]);
+    assert(&list[2] == two);
+
+    //Act Assert - sorted list keeps equal objects in insertion order
+    SortedLinkedList<KeyValue, bool(*)(const KeyValue&, const KeyValue&)> sorted(
+        [](const KeyValue &a, const KeyValue &b){ return a.key < b.key; });
+    SortedLinkedList<KeyValue, bool(*)(const KeyValue&, const KeyValue&)> more(sorted);
+    for (int i = 0; i != 20; ++i){
+        assert(sorted.add(KeyValue{(i * 7) % 5, i}) == true);
+        assert(more.add(KeyValue{(i * 3) % 5, 20 + i}) == true);
+    }
+    assert(sorted.lower_bound(KeyValue{2, 0}) == 8);
+    assert(sorted.upper_bound(KeyValue{2, 0}) == 12);
+    assert(sorted.merge(more) == true);
+    assert(sorted.size() == 40);
+    auto prev = sorted.begin();
+    for (auto i = sorted.begin(); ++i != sorted.end(); prev = i)
+        assert((*prev).key < (*i).key || ((*prev).key == (*i).key && (*prev).value < (*i).value));
+    sorted.remove(3);
+    assert(sorted.add(KeyValue{0, 100}) == true);
+    assert(sorted[7].value == 100);
+
+    //Act Assert - objects found are read-only, so the order could not break behind the list
+    static_assert(std::is_same<decltype(sorted.find(KeyValue{0, 100})), const KeyValue*>::value, "find() must return const");
+    auto hundred = [](const KeyValue &kv){ return kv.value == 100; };
+    static_assert(std::is_same<decltype(sorted.find_if(hundred)), const KeyValue*>::value, "find_if() must return const");
+    assert(sorted.find_if(hundred) == &sorted[7]);
+}
+
+// same calls as on LinkedList, so list types could be swapped with a typedef
+template<class List>
+void check_list_api(List &list)
+{
+    for (int i = 0; i != 10; ++i)
+        assert(list.add(i) == true);
+    assert(list.unshift(-1) == true);
+    assert(list.add(5, 100) == true);
+    assert(list.size() == 12);
+    assert(list.get(0) == -1 && list.get(5) == 100 && list.get(6) == 4);
+    assert(list.front() == -1 && list.back() == 9);
+    assert(list.remove(5) == 100);
+    assert(list.shift() == -1);
+    assert(list.pop() == 9);
+    assert(list.set(1, 10) == true);
+    list.sort(std::greater<int>());
+    int prev = 11, sum = 0;
+    for (int i : list){
+        assert(i < prev);
+        prev = i;
+        sum += i;
+    }
+    assert(sum == 45 && prev == 0);
+    list.clear();
+    assert(list.size() == 0);
+    assert(list.get(0) == 0);
+}
+
+void GivenRingBufferList_WhenUsedAsFifo_ThenBehavesLikeLinkedList()
+{
+    //Arrange
+    LinkedList<int> linked;
+    RingBufferList<int> ring;
+    RingBufferList<int, 4> fixed;
+
+    //Act Assert - same API
+    check_list_api(linked);
+    check_list_api(ring);
+
+    //Act Assert - FIFO wraps around the buffer without growing
+    assert(ring.reserve(4) == true);
+    unsigned capacity = ring.capacity();
+    for (int i = 0; i != 100; ++i){
+        assert(ring.add(i) == true);
+        if (i >= 3)
+            assert(ring.shift() == i - 3);
+    }
+    assert(ring.capacity() == capacity);
+    assert(ring.size() == 3);
+    assert(ring[0] == 97 && ring[2] == 99);
+
+    //Act Assert - fixed buffer rejects objects when full
+    for (int i = 0; i != 4; ++i)
+        assert(fixed.unshift(i) == true);
+    assert(fixed.add(4) == false);
+    assert(fixed.reserve(5) == false);
+    assert(fixed.pop() == 0);
+    assert(fixed.add(1, 10) == true);
+    assert(fixed[0] == 3 && fixed[1] == 10 && fixed[2] == 2 && fixed[3] == 1);
+
+    //Act Assert - copies and moves
+    RingBufferList<int> copy(ring);
+    RingBufferList<int> moved(std::move(ring));
+    assert(ring.size() == 0);
+    assert(copy.size() == 3 && moved.size() == 3);
+    assert(copy[1] == 98 && moved[1] == 98);
+    RingBufferList<int, 4> fixedCopy(fixed);
+    assert(fixedCopy[1] == 10);
+}
+
+void GivenFixedRingBufferList_WhenSorted_ThenStableInPlace()
+{
+    for (unsigned n = 0; n != 64; ++n){
+        //Arrange - objects wrap around the end of the buffer
+        RingBufferList<KeyValue, 64> fixed;
+        RingBufferList<KeyValue> growable;
+        for (unsigned i = 0; i != 64 - n / 2; ++i)
+            fixed.add(KeyValue{0, 0});
+        for (unsigned i = 0; i != 64 - n / 2; ++i)
+            fixed.shift();
+        for (unsigned i = 0; i != n; ++i){
+            KeyValue kv{int((i * 37) % 7), int(i)};
+            assert(fixed.add(kv) == true);
+            growable.add(kv);
+        }
+
+        //Act
+        fixed.sort([](const KeyValue &a, const KeyValue &b){ return a.key < b.key; });
+        growable.sort([](const KeyValue &a, const KeyValue &b){ return a.key < b.key; });
+
+        //Assert - equal keys keep their order, same as std::stable_sort
+        assert(fixed.size() == n);
+        for (unsigned i = 0; i != n; ++i){
+            assert(fixed[i].key == growable[i].key && fixed[i].value == growable[i].value);
+            if (i)
+                assert(fixed[i - 1].key < fixed[i].key || (fixed[i - 1].key == fixed[i].key && fixed[i - 1].value < fixed[i].value));
+        }
+    }
+
+    //Act Assert - strcmp-like comparator taking non-const references
+    RingBufferList<int, 8> ints;
+    RingBufferList<int> moreInts;
+    for (int i : {5, 3, 7, 1, 3, 0}){
+        ints.add(i);
+        moreInts.add(i);
+    }
+    ints.sort(cmp_int);
+    moreInts.sort(cmp_int);
+    assert(ints[0] == 0 && ints[1] == 1 && ints[2] == 3 && ints[3] == 3 && ints[4] == 5 && ints[5] == 7);
+    for (unsigned i = 0; i != 6; ++i)
+        assert(moreInts[i] == ints[i]);
+}
+
+void GivenBoundedList_WhenFull_ThenPolicyApplied()
+{
+    //Arrange
+    PooledLinkedList<int, 4> telemetry;     // pool has no spare nodes, so dropped nodes must be reused
+    LinkedList<int> rejecting;
+    LinkedList<int> dropping;
+    int more[] = {7, 8, 9};
+
+    //Act Assert - drop_oldest keeps the latest objects
+    telemetry.setCapacity(4, ListOverflow::drop_oldest);
+    for (int i = 0; i != 100; ++i)
+        assert(telemetry.add(i) == true);
+    assert(telemetry.size() == 4);
+    assert(telemetry[0] == 96 && telemetry[3] == 99);
+    assert(telemetry.dropped() == 96);
+    assert(telemetry.highWaterMark() == 4);
+    assert(telemetry.add(2, -1) == true);
+    assert(telemetry[0] == 97 && telemetry[1] == -1 && telemetry[2] == 98 && telemetry[3] == 99);
+    assert(telemetry.unshift(-2) == true);
+    assert(telemetry[0] == -2 && telemetry[1] == -1);
+    assert(telemetry.add(telemetry.front_ref()) == true);
+    assert(telemetry[0] == -1 && telemetry[3] == -2);
+
+    //Act Assert - object taken from the list is copied before the oldest one is dropped
+    LinkedList<std::string> names;
+    names.setCapacity(3, ListOverflow::drop_oldest);
+    for (const char *n : {"first object, long enough to be on the heap", "second", "third"})
+        names.add(n);
+    assert(names.add(1, names[0]) == true);
+    assert(names[0] == "first object, long enough to be on the heap" && names[1] == "second");
+    assert(names.add(2, names[0]) == true);
+    assert(names[0] == "second" && names[1] == "first object, long enough to be on the heap");
+
+    //Act Assert - drop_oldest range never takes more nodes than capacity
+    int burst[10] = {10, 11, 12, 13, 14, 15, 16, 17, 18, 19};
+    telemetry.resetHighWaterMark();
+    assert(telemetry.add_range(burst, burst + 10) == true);
+    assert(telemetry.size() == 4);
+    assert(telemetry[0] == 16 && telemetry[3] == 19);
+    assert(telemetry.highWaterMark() <= telemetry.capacity());
+    assert(telemetry.insert_range(2, more, more + 2) == true);
+    assert(telemetry[0] == 7 && telemetry[1] == 8 && telemetry[2] == 18 && telemetry[3] == 19);
+    assert(telemetry.insert_range(1, burst, burst + 5) == true);
+    assert(telemetry[0] == 14 && telemetry[1] == 8 && telemetry[3] == 19);
+    assert(telemetry.insert_range(0, burst, burst + 3) == true);
+    assert(telemetry[0] == 12 && telemetry[1] == 8 && telemetry.size() == 4);
+    assert(telemetry.highWaterMark() == 4);
+
+    //Act Assert - range follows the same policy as single inserts
+    LinkedList<int> single, ranged;
+    single.setCapacity(3, ListOverflow::drop_oldest);
+    ranged.setCapacity(3, ListOverflow::drop_oldest);
+    for (int i = 1; i != 4; ++i){
+        single.add(i);
+        ranged.add(i);
+    }
+    assert(single.add(0, 9) == true);
+    assert(ranged.insert_range(0, burst, burst + 1) == true);
+    assert(single[0] == 9 && single[1] == 2 && single[2] == 3);
+    assert(ranged[0] == 10 && ranged[1] == 2 && ranged[2] == 3);
+
+    //Act Assert - objects moved from lists with own pools are not limited, same as relinked nodes
+    PooledLinkedList<int, 8> full, source;
+    full.setCapacity(2);
+    full.add(1);
+    full.add(5);
+    for (int i : {2, 3, 4})
+        source.add(i);
+    assert(full.splice_range(1, source, 0, 2) == true);
+    assert(full.size() == 4 && full[1] == 2 && full[2] == 3 && full[3] == 5);
+    assert(full.merge(source) == true);
+    assert(full.size() == 5 && full[3] == 4 && source.size() == 0);
+    assert(full.dropped() == 0);
+
+    //Act Assert - reject
+    rejecting.setCapacity(3);
+    for (int i = 0; i != 3; ++i)
+        assert(rejecting.add(i) == true);
+    assert(rejecting.add(3) == false);
+    assert(rejecting.unshift(3) == false);
+    assert(rejecting.add(1, 3) == false);
+    assert(rejecting.insert_range(0, more, more + 1) == false);
+    assert(rejecting.begin().insert_after(3) == false);
+    assert(rejecting.dropped() == 0);
+    assert(rejecting.pop() == 2);
+    assert(rejecting.add(3) == true);
+    assert(rejecting.size() == 3);
+    assert(rejecting.highWaterMark() == 3);
+    rejecting.pop();
+    assert(rejecting.insert_range(1, more, more + 3) == false);
+    assert(rejecting.size() == 3 && rejecting[1] == 7 && rejecting.dropped() == 0);
+
+    //Act Assert - drop_newest counts dropped objects
+    for (int i = 0; i != 6; ++i)
+        dropping.add(i);
+    dropping.setCapacity(4, ListOverflow::drop_newest);
+    assert(dropping.size() == 4);
+    assert(dropping.back() == 3);
+    assert(dropping.add(10) == false);
+    assert(dropping.insert_range(0, more, more + 3) == false);
+    assert(dropping.dropped() == 4);
+    dropping.shift();
+    dropping.shift();
+    assert(dropping.insert_range(1, more, more + 3) == false);
+    assert(dropping[0] == 2 && dropping[1] == 7 && dropping[2] == 8 && dropping[3] == 3);
+    assert(dropping.dropped() == 5);
+    assert(dropping.highWaterMark() == 6);
+    dropping.resetHighWaterMark();
+    assert(dropping.highWaterMark() == 4);
+
+    //Act Assert - unlimited again
+    dropping.setCapacity(0);
+    assert(dropping.add(10) == true);
+    assert(dropping.size() == 5);
+}
+
+// heap allocator handing out a limited number of nodes per instance, budget is taken on construction
+template<class Node>
+struct BudgetAllocator {
+    static constexpr bool is_always_equal = false;
+    static unsigned initial;
+    unsigned budget = initial;
+
+    Node* allocate(){ return budget ? (--budget, static_cast<Node*>(::operator new(sizeof(Node)))) : nullptr; }
+    void deallocate(Node *n){ ++budget; ::operator delete(n); }
+};
+template<class Node>
+unsigned BudgetAllocator<Node>::initial = 0;
+
+template<class List, class Node>
+void check_move_keeps_rest(unsigned nodes, unsigned moved)
+{
+    BudgetAllocator<Node>::initial = 100;
+    List source;
+    for (int i = 0; i != 5; ++i)
+        assert(source.add(i) == true);
+    BudgetAllocator<Node>::initial = nodes;
+    List target;
+
+    target = std::move(source);
+    assert(target.size() == moved);
+    assert(source.size() == 5 - moved);
+    for (unsigned i = 0; i != moved; ++i)
+        assert(target[i] == (int)i);
+    for (unsigned i = 0; i != source.size(); ++i)
+        assert(source[i] == (int)(moved + i));
+}
+
+void GivenTargetOutOfNodes_WhenMoveAssigned_ThenObjectsLeftInSource()
+{
+    check_move_keeps_rest< LinkedList<int, BudgetAllocator< ListNode<int> > >, ListNode<int> >(2, 2);
+    check_move_keeps_rest< DLinkedList<int, BudgetAllocator< DListNode<int> > >, DListNode<int> >(2, 2);
+    check_move_keeps_rest< UnrolledLinkedList<int, 2, BudgetAllocator< UnrolledNode<int, 2> > >, UnrolledNode<int, 2> >(2, 4);
+    check_move_keeps_rest< CompactLinkedList<int, uint16_t, BudgetAllocator< ListNode<int> > >, ListNode<int> >(2, 2);
+
+    // bounded list takes all moved objects, same as relinked nodes
+    BudgetAllocator< ListNode<int> >::initial = 100;
+    LinkedList<int, BudgetAllocator< ListNode<int> > > source, bounded;
+    for (int i = 0; i != 5; ++i)
+        source.add(i);
+    bounded.setCapacity(2);
+    bounded = std::move(source);
+    assert(bounded.size() == 5 && source.size() == 0);
+}
+
+void GivenCachedList_WhenUsedAsQueue_ThenNodesReused()
+{
+    //Arrange
+    CachedLinkedList<int> queue;
+    LinkedListCore<int, NodeCacheAllocator< ListNode<int> > > core;
+
+    //Act Assert - released nodes are handed out again
+    for (int i = 0; i != 8; ++i)
+        queue.add(i);
+    const int *first = &queue.front_ref();
+    queue.shift();
+    assert(queue.allocator().cached() == 1);
+    queue.add(8);
+    assert(&queue.back_ref() == first);
+    assert(queue.allocator().cached() == 0);
+
+    //Act Assert - reserve() counts nodes in the list
+    assert(queue.reserve(20) == true);
+    assert(queue.allocator().cached() == 12);
+    for (int i = 0; i != 12; ++i)
+        queue.unshift(i);
+    assert(queue.allocator().cached() == 0);
+
+    //Act Assert - clear() keeps nodes up to the limit
+    queue.allocator().setLimit(5);
+    queue.clear();
+    assert(queue.allocator().cached() == 5);
+    queue.shrink_to_fit();
+    assert(queue.allocator().cached() == 0);
+
+    //Act Assert - reserve() does not cache nodes over the limit
+    assert(queue.reserve(8) == false);
+    assert(queue.allocator().cached() == 5);
+    assert(queue.reserve(3) == true);
+    assert(queue.allocator().cached() == 5);
+    queue.shrink_to_fit();
+
+    //Act Assert - nodes spliced between lists with own caches
+    core.add(1);
+    queue.add(2);
+    queue.splice(0, core);
+    queue.pop();
+    queue.pop();
+    assert(queue.allocator().cached() == 2);
+    assert(core.allocator().cached() == 0);
+}
+
+void GivenSlabList_WhenFilledAndCopied_ThenNodesContiguous()
+{
+    //Arrange
+    SlabLinkedList<int> list(10, 7);
+    auto adjacent = [](SlabLinkedList<int> &l){
+        for (unsigned i = 1; i < l.size(); ++i)
+            if ((const char*)&l[i] - (const char*)&l[i - 1] != (const char*)&l[1] - (const char*)&l[0])
+                return false;
+        return true;
+    };
+
+    //Act Assert - fill constructor takes one slab
+    assert(list.size() == 10);
+    assert(list.allocator().capacity() == 10);
+    assert(adjacent(list));
+
+    //Act Assert - copy reserves nodes for the whole list
+    for (int i = 0; i != 10; ++i)
+        list[i] = i;
+    SlabLinkedList<int> copy(list);
+    assert(copy.allocator().capacity() == 10);
+    assert(adjacent(copy));
+    for (int i = 0; i != 10; ++i)
+        assert(copy[i] == i);
+
+    //Act Assert - assignment reuses free nodes and reserves missing ones
+    SlabLinkedList<int> other(4, 1);
+    other = list;
+    other = other;
+    assert(other.size() == 10);
+    assert(other.allocator().capacity() == 10);
+    assert(other.back() == 9);
+
+    //Act Assert - growth adds slabs, only unused slabs are released
+    for (int i = 10; i != 20; ++i)
+        list.add(i);
+    assert(list.allocator().capacity() == 10 + 5 + 7);
+    while (list.size() > 5)
+        list.pop();
+    list.shrink_to_fit();
+    assert(list.allocator().capacity() == 10);
+    assert(list.back() == 4);
+
+    //Act Assert - moved objects stay in nodes of their own list
+    SlabLinkedList<int> moved(std::move(list));
+    assert(moved.size() == 5 && list.size() == 0);
+    list.shrink_to_fit();
+    assert(list.allocator().capacity() == 0);
+    moved.clear();
+    moved.shrink_to_fit();
+    assert(moved.allocator().available() == 0);
+}
+
+#ifdef LINKEDLIST_STATS
+void GivenList_WhenAccessedByIndex_ThenStatsCounted()
+{
+    //Arrange
+    LinkedList<int> list;
+    char buf[256];
+    for (int i = 0; i != 10; ++i)
+        list.add(i);
+    list.get(1);
+    list.resetStats();
+
+    //Act Assert - sequential access walks one node per call from the cache
+    for (unsigned i = 2; i != 9; ++i)
+        list.get(i);
+    assert(list.stats().getNode == 7);
+    assert(list.stats().cacheHits == 7);
+    assert(list.stats().cacheMisses == 0);
+    assert(list.stats().traversed == 7);
+
+    //Act Assert - going back walks from the root
+    list.get(2);
+    assert(list.stats().cacheMisses == 1);
+    assert(list.stats().traversed == 9);
+
+    //Act Assert - pop scans, allocations and sort comparisons
+    list.pop();
+    assert(list.stats().popScans == 1);
+    assert(list.stats().frees == 1);
+    list.add(-1);
+    list.sort();
+    assert(list.stats().allocs == 1);
+    assert(list.stats().compares > 0);
+    assert(list.stats().peakSize == 10);
+
+    //Act Assert - dump
+    int len = list.dumpStats(buf, sizeof(buf));
+    assert(len > 0 && len < (int)sizeof(buf));
+    assert(std::string(buf).find("popScans=1") != std::string::npos);
+    assert(list.dumpStats(buf, 8) == len);
+    assert(std::string(buf) == "getNode");
+}
+#endif
+
 int main()
 {
     GivenNothingInList_WhenSizeCalled_Returns0();
@@ -468,6 +1983,40 @@ int main()
     GivenThreeInList_WhenConstInteratorCalled_ThenCount3Elements();
     GivenTwoInList_chk_exist();
     GivenList_makeclone();
+    GivenPooledList_WhenPoolExhausted_ThenAddFailsAndNodesRecycled();
+    GivenList_WhenEmplacedAndMoved_ThenNoCopiesMade();
+    GivenList_WhenMoved_ThenNodesTakenOver();
+    GivenDList_WhenAccessedFromBothEnds_ThenReturnsData();
+    GivenDList_WhenSortedAndCopied_ThenLinksConsistent();
+    GivenUnrolledList_WhenInsertedAndRemoved_ThenOrderKept();
+    GivenUnrolledList_WhenSortedAndCopied_ThenOrderKept();
+    GivenConcurrentList_WhenReadWithCursor_ThenCursorFollowsChanges();
+    GivenList_WhenEditedViaCursor_ThenListConsistent();
+    GivenList_WhenEditedWhileIterating_ThenListConsistent();
+    GivenIndexedList_WhenAccessedRandomly_ThenMatchesLinkedList();
+    GivenLists_WhenSortedWithLambda_ThenSortIsStable();
+    GivenList_WhenSortedWithFunctors_ThenOrderMatches();
+    GivenTwoLists_WhenSplicedAndSplit_ThenNodesRelinked();
+    GivenPooledLists_WhenSpliced_ThenObjectsMoved();
+    GivenList_WhenBulkEdited_ThenElementsMatch();
+    GivenIntrusiveList_WhenObjectsLinked_ThenNoCopiesMade();
+    GivenStaticList_WhenFull_ThenAddFailsAndNodesReused();
+    GivenCompactList_WhenSizeTypeExhausted_ThenAddFails();
+    GivenCoreList_WhenAccessedByReference_ThenNoDummyObjectsNeeded();
+    GivenDerivedList_WhenBaseMethodsCalled_ThenOverridesDispatched();
+    GivenList_WhenSearched_ThenPositionsFound();
+    GivenHashedList_WhenEdited_ThenIndexConsistent();
+    GivenHashedList_WhenKeysShareLowBits_ThenProbeRunsShort();
+    GivenSortedLists_WhenInsertedAndMerged_ThenOrderKept();
+    GivenRingBufferList_WhenUsedAsFifo_ThenBehavesLikeLinkedList();
+    GivenFixedRingBufferList_WhenSorted_ThenStableInPlace();
+    GivenBoundedList_WhenFull_ThenPolicyApplied();
+    GivenCachedList_WhenUsedAsQueue_ThenNodesReused();
+    GivenTargetOutOfNodes_WhenMoveAssigned_ThenObjectsLeftInSource();
+    GivenSlabList_WhenFilledAndCopied_ThenNodesContiguous();
+#ifdef LINKEDLIST_STATS
+    GivenList_WhenAccessedByIndex_ThenStatsCounted();
+#endif
 
     std::cout<< "Tests pass"<< std::endl;
 }